@@ -28,6 +28,11 @@ volatile uint8_t button_was_pressed_bits;
 // callback for timer ticks
 uint8_t (*get_timer_ticks)(void);
 
+// Button pin states as of the last interrupt.  The epaper BUSY pin shares
+// the interrupt so this is used to ignore changes that are not buttons.
+#define BUTTON_PINS ((1 << SELECT_BUTTON_PIN) | (1 << OPTION_BUTTON_PIN))
+static uint8_t last_button_pins;
+
 //
 // public interface
 //
@@ -43,7 +48,8 @@ void buttons_init(uint8_t (*timer_ticks)(void)) {
   PCICR = 1 << 2;  // Enable pin change interrupts for the buttons
 
   // Allow these two pins to trigger the interrupt
-  PCMSK2 = (1 << SELECT_BUTTON_PIN) | (1 << OPTION_BUTTON_PIN);
+  PCMSK2 = BUTTON_PINS;
+  last_button_pins = SELECT_BUTTON_INPUT & BUTTON_PINS;
 }
 
 // Gives the current state of the select button
@@ -63,6 +69,13 @@ void clear_button_press_state(void) {
 
 // This is called whenever either button is pressed
 ISR(PCINT2_vect) {
+  const uint8_t button_pins = SELECT_BUTTON_INPUT & BUTTON_PINS;
+  if (button_pins == last_button_pins) {
+    // Something else on the port, like the epaper BUSY pin
+    return;
+  }
+  last_button_pins = button_pins;
+
   const uint16_t button_tick = get_timer_ticks();
   // The debounce zone is last_button_press_tick <= button_tick <= last_button_press_tick + BUTTON_DEBOUNCE_TICKS 
   if ((button_tick >= last_button_press_tick) &&
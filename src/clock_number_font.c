@@ -4,23 +4,24 @@
 #include <avr/pgmspace.h> 
 
 const uint8_t clock_number_font[] PROGMEM = {
-    0x56, 0x41, 0x52, 0x31,  // id: VAR1
-    0x0C, // num_chars
-    0x0A, // height
+    0x56, 0x41, 0x52, 0x32,  // id: VAR2
+    0x0D, // num_chars
+    0x8A, // height | VARIABLE_FONT_REVERSED
 
     // Character offsets
-    ' ', 40, 0x00, 0x30,  // off=48
-    '0', 40, 0x00, 0x38,  // off=56
-    '1', 40, 0x00, 0xED,  // off=237
-    '2', 40, 0x01, 0x36,  // off=310
-    '3', 40, 0x01, 0xCC,  // off=460
-    '4', 40, 0x02, 0x7D,  // off=637
-    '5', 40, 0x02, 0xEE,  // off=750
-    '6', 40, 0x03, 0x7F,  // off=895
-    '7', 40, 0x04, 0x47,  // off=1095
-    '8', 40, 0x04, 0xA1,  // off=1185
-    '9', 40, 0x05, 0x77,  // off=1399
-    ':', 16, 0x06, 0x42,  // off=1602
+    0, 0, 0x30, 11,  // dense index 0-:
+    ' ', 40, 0x00, 0x34,  // off=52
+    '0', 40, 0x00, 0x3C,  // off=60
+    '1', 40, 0x00, 0xF1,  // off=241
+    '2', 40, 0x01, 0x3A,  // off=314
+    '3', 40, 0x01, 0xC5,  // off=453
+    '4', 40, 0x02, 0x6B,  // off=619
+    '5', 40, 0x02, 0xDC,  // off=732
+    '6', 40, 0x03, 0x6D,  // off=877
+    '7', 40, 0x04, 0x1E,  // off=1054
+    '8', 40, 0x04, 0x78,  // off=1144
+    '9', 40, 0x05, 0x2E,  // off=1326
+    ':', 16, 0x05, 0xEE,  // off=1518
     // Character data
     // Character 32 (0x20) ( )
     // ----------------------------------------
@@ -185,18 +186,18 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x0A, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x03, 0xE0, 0x08, 0xF0, 0x02, 0xE0, 0x02, 0xC0, 0x81, 0x80,
-    0x10, 0x00, 0x84, 0x80, 0xF0, 0xF8, 0xFC, 0x04, 0xFF, 0x83, 0x7F, 0x3F, 0x1F, 0x07, 0x0F, 0x02,
-    0x1F, 0x81, 0x3F, 0x04, 0xFF, 0x84, 0xFE, 0xF8, 0xF0, 0xC0, 0x0A, 0x00, 0x81, 0xFE, 0x05, 0xFF,
-    0x82, 0x1F, 0x01, 0x0F, 0x00, 0x82, 0x01, 0x07, 0x05, 0xFF, 0x82, 0xFC, 0xF0, 0x06, 0x00, 0x81,
-    0xE0, 0x06, 0xFF, 0x15, 0x00, 0x81, 0x3F, 0x05, 0xFF, 0x81, 0xC0, 0x05, 0x00, 0x07, 0xFF, 0x07,
-    0x00, 0x08, 0xFE, 0x07, 0x00, 0x06, 0xFF, 0x05, 0x00, 0x07, 0xFF, 0x07, 0x00, 0x08, 0x3F, 0x07,
-    0x00, 0x06, 0xFF, 0x05, 0x00, 0x82, 0x01, 0x7F, 0x05, 0xFF, 0x81, 0x80, 0x13, 0x00, 0x82, 0xC0,
-    0xFE, 0x05, 0xFF, 0x81, 0x01, 0x07, 0x00, 0x82, 0x1F, 0x7F, 0x04, 0xFF, 0x83, 0xFC, 0xC0, 0x80,
-    0x0D, 0x00, 0x83, 0x80, 0xE0, 0xF0, 0x05, 0xFF, 0x82, 0x1F, 0x03, 0x0A, 0x00, 0x83, 0x07, 0x0F,
-    0x1F, 0x02, 0x7F, 0x03, 0xFF, 0x81, 0xFE, 0x02, 0xFC, 0x05, 0xF8, 0x02, 0xFC, 0x02, 0xFE, 0x03,
-    0xFF, 0x85, 0x7F, 0x3F, 0x0F, 0x03, 0x01, 0x11, 0x00, 0x03, 0x01, 0x02, 0x03, 0x08, 0x07, 0x02,
-    0x03, 0x81, 0x01, 0x0D, 0x00,
+    0x0A, 0x00, 0x81, 0x01, 0x02, 0x03, 0x03, 0x07, 0x08, 0x0F, 0x02, 0x07, 0x02, 0x03, 0x81, 0x01,
+    0x10, 0x00, 0x84, 0x01, 0x0F, 0x1F, 0x3F, 0x04, 0xFF, 0x83, 0xFE, 0xFC, 0xF8, 0x07, 0xF0, 0x02,
+    0xF8, 0x81, 0xFC, 0x04, 0xFF, 0x84, 0x7F, 0x1F, 0x0F, 0x03, 0x0A, 0x00, 0x81, 0x7F, 0x05, 0xFF,
+    0x82, 0xF8, 0x80, 0x0F, 0x00, 0x82, 0x80, 0xE0, 0x05, 0xFF, 0x82, 0x3F, 0x0F, 0x06, 0x00, 0x81,
+    0x07, 0x06, 0xFF, 0x15, 0x00, 0x81, 0xFC, 0x05, 0xFF, 0x81, 0x03, 0x05, 0x00, 0x07, 0xFF, 0x07,
+    0x00, 0x08, 0x7F, 0x07, 0x00, 0x06, 0xFF, 0x05, 0x00, 0x07, 0xFF, 0x07, 0x00, 0x08, 0xFC, 0x07,
+    0x00, 0x06, 0xFF, 0x05, 0x00, 0x82, 0x80, 0xFE, 0x05, 0xFF, 0x81, 0x01, 0x13, 0x00, 0x82, 0x03,
+    0x7F, 0x05, 0xFF, 0x81, 0x80, 0x07, 0x00, 0x82, 0xF8, 0xFE, 0x04, 0xFF, 0x83, 0x3F, 0x03, 0x01,
+    0x0D, 0x00, 0x83, 0x01, 0x07, 0x0F, 0x05, 0xFF, 0x82, 0xF8, 0xC0, 0x0A, 0x00, 0x83, 0xE0, 0xF0,
+    0xF8, 0x02, 0xFE, 0x03, 0xFF, 0x81, 0x7F, 0x02, 0x3F, 0x05, 0x1F, 0x02, 0x3F, 0x02, 0x7F, 0x03,
+    0xFF, 0x85, 0xFE, 0xFC, 0xF0, 0xC0, 0x80, 0x11, 0x00, 0x03, 0x80, 0x02, 0xC0, 0x08, 0xE0, 0x02,
+    0xC0, 0x81, 0x80, 0x0D, 0x00,
     // Character 49 (0x31) (1)
     // ----------------------------------------
     // ----------------------------------------
@@ -278,11 +279,11 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x13, 0x00, 0x07, 0xE0, 0x18, 0x00, 0x02, 0x80, 0x02, 0xC0, 0x84, 0xE0, 0xF0, 0xFC, 0xFE, 0x08,
-    0xFF, 0x12, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0x7F, 0x02, 0x3F, 0x85, 0x1F, 0x0F, 0x07, 0x03,
-    0x01, 0x07, 0xFF, 0x12, 0x00, 0x03, 0x01, 0x0C, 0x00, 0x07, 0xFF, 0x21, 0x00, 0x07, 0xFF, 0x21,
-    0x00, 0x07, 0xFF, 0x21, 0x00, 0x07, 0xFF, 0x21, 0x00, 0x07, 0xFF, 0x12, 0x00, 0x0F, 0xFC, 0x07,
-    0xFF, 0x0D, 0xFC, 0x05, 0x00, 0x23, 0x03, 0x01, 0x00,
+    0x13, 0x00, 0x07, 0x07, 0x18, 0x00, 0x02, 0x01, 0x02, 0x03, 0x84, 0x07, 0x0F, 0x3F, 0x7F, 0x08,
+    0xFF, 0x12, 0x00, 0x03, 0x7F, 0x03, 0xFF, 0x02, 0xFE, 0x02, 0xFC, 0x85, 0xF8, 0xF0, 0xE0, 0xC0,
+    0x80, 0x07, 0xFF, 0x12, 0x00, 0x03, 0x80, 0x0C, 0x00, 0x07, 0xFF, 0x21, 0x00, 0x07, 0xFF, 0x21,
+    0x00, 0x07, 0xFF, 0x21, 0x00, 0x07, 0xFF, 0x21, 0x00, 0x07, 0xFF, 0x12, 0x00, 0x0F, 0x3F, 0x07,
+    0xFF, 0x0D, 0x3F, 0x05, 0x00, 0x23, 0xC0, 0x01, 0x00,
     // Character 50 (0x32) (2)
     // ----------------------------------------
     // ----------------------------------------
@@ -364,16 +365,15 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x0A, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x03, 0xE0, 0x08, 0xF0, 0x03, 0xE0, 0x02, 0xC0, 0x81, 0x80,
-    0x0F, 0x00, 0x84, 0x80, 0xF0, 0xF8, 0xFC, 0x04, 0xFF, 0x83, 0x7F, 0x3F, 0x1F, 0x07, 0x0F, 0x02,
-    0x1F, 0x82, 0x3F, 0x7F, 0x04, 0xFF, 0x84, 0xFE, 0xFC, 0xF8, 0x80, 0x09, 0x00, 0x82, 0x7E, 0x7F,
-    0x04, 0xFF, 0x82, 0x1F, 0x01, 0x10, 0x00, 0x81, 0x01, 0x06, 0xFF, 0x81, 0xFC, 0x1F, 0x00, 0x82,
-    0x80, 0xC0, 0x05, 0xFF, 0x82, 0x3F, 0x07, 0x1A, 0x00, 0x85, 0x80, 0xC0, 0xF0, 0xF8, 0xFE, 0x03,
-    0xFF, 0x84, 0x7F, 0x1F, 0x07, 0x03, 0x15, 0x00, 0x84, 0x80, 0xC0, 0xE0, 0xF0, 0x02, 0xFC, 0x03,
-    0xFF, 0x02, 0x3F, 0x83, 0x0F, 0x07, 0x03, 0x14, 0x00, 0x85, 0x80, 0xC0, 0xF0, 0xF8, 0xFC, 0x03,
-    0xFF, 0x86, 0x7F, 0x3F, 0x0F, 0x07, 0x03, 0x01, 0x15, 0x00, 0x85, 0x80, 0xE0, 0xF8, 0xFC, 0xFE,
-    0x02, 0xFF, 0x85, 0x7F, 0x3F, 0x1F, 0x03, 0x01, 0x1B, 0x00, 0x81, 0xFC, 0x07, 0xFF, 0x19, 0xFC,
-    0x07, 0x00, 0x21, 0x03, 0x04, 0x00,
+    0x00, 0x1A, 0x00, 0xFE, 0x01, 0x07, 0x00, 0x12, 0x00, 0xF8, 0x00, 0x15, 0x00, 0xF6, 0x82, 0xFE,
+    0xFF, 0x00, 0x05, 0x00, 0x7C, 0x82, 0x1F, 0x01, 0x09, 0x00, 0x82, 0x7E, 0xFE, 0x04, 0xFF, 0x00,
+    0x11, 0x00, 0xED, 0x82, 0x00, 0x80, 0x06, 0xFF, 0x81, 0x3F, 0x02, 0x00, 0x00, 0x1F, 0x01, 0x2C,
+    0x05, 0xFF, 0x82, 0xFC, 0xE0, 0x10, 0x00, 0x00, 0x0C, 0x01, 0x35, 0x83, 0x0F, 0x1F, 0x7F, 0x03,
+    0xFF, 0x84, 0xFE, 0xF8, 0xE0, 0xC0, 0x0B, 0x00, 0x00, 0x0C, 0x01, 0x46, 0x82, 0x07, 0x0F, 0x02,
+    0x3F, 0x03, 0xFF, 0x02, 0xFC, 0x83, 0xF0, 0xE0, 0xC0, 0x0A, 0x00, 0x00, 0x0C, 0x01, 0x59, 0x83,
+    0x0F, 0x1F, 0x3F, 0x00, 0x06, 0x00, 0xC2, 0x83, 0xE0, 0xC0, 0x80, 0x08, 0x00, 0x00, 0x0F, 0x00,
+    0xEB, 0x83, 0x1F, 0x3F, 0x7F, 0x02, 0xFF, 0x85, 0xFE, 0xFC, 0xF8, 0xC0, 0x80, 0x1B, 0x00, 0x81,
+    0x3F, 0x07, 0xFF, 0x19, 0x3F, 0x07, 0x00, 0x21, 0xC0, 0x04, 0x00,
     // Character 51 (0x33) (3)
     // ----------------------------------------
     // ----------------------------------------
@@ -455,18 +455,17 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x0A, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x03, 0xE0, 0x08, 0xF0, 0x03, 0xE0, 0x02, 0xC0, 0x81, 0x80,
-    0x0F, 0x00, 0x84, 0xC0, 0xF8, 0xFC, 0xFE, 0x04, 0xFF, 0x81, 0x7F, 0x02, 0x1F, 0x08, 0x0F, 0x83,
-    0x1F, 0x3F, 0x7F, 0x04, 0xFF, 0x84, 0xFE, 0xFC, 0xF8, 0x80, 0x09, 0x00, 0x02, 0x3F, 0x04, 0x7F,
-    0x82, 0x1F, 0x01, 0x10, 0x00, 0x81, 0x01, 0x06, 0xFF, 0x81, 0xFC, 0x1E, 0x00, 0x83, 0x80, 0xC0,
-    0xE0, 0x05, 0xFF, 0x82, 0x1F, 0x03, 0x13, 0x00, 0x06, 0xF8, 0x03, 0xFC, 0x02, 0xFE, 0x02, 0xBF,
-    0x02, 0x1F, 0x83, 0x0F, 0x03, 0x01, 0x16, 0x00, 0x07, 0x07, 0x03, 0x0F, 0x81, 0x1F, 0x02, 0x3F,
-    0x84, 0x7F, 0xFF, 0xFE, 0xFC, 0x02, 0xF8, 0x82, 0xE0, 0x80, 0x0A, 0x00, 0x03, 0x80, 0x14, 0x00,
-    0x82, 0x01, 0x07, 0x05, 0xFF, 0x81, 0xF8, 0x06, 0x00, 0x81, 0x07, 0x05, 0xFF, 0x83, 0xFE, 0xF0,
-    0x80, 0x11, 0x00, 0x82, 0xE0, 0xF8, 0x05, 0xFF, 0x81, 0x0F, 0x08, 0x00, 0x84, 0x03, 0x0F, 0x1F,
-    0x3F, 0x05, 0xFF, 0x02, 0xFC, 0x08, 0xF8, 0x02, 0xFC, 0x81, 0xFE, 0x04, 0xFF, 0x85, 0x7F, 0x3F,
-    0x1F, 0x07, 0x01, 0x0F, 0x00, 0x02, 0x01, 0x03, 0x03, 0x09, 0x07, 0x03, 0x03, 0x81, 0x01, 0x0B,
-    0x00,
+    0x00, 0x1A, 0x01, 0x89, 0x01, 0x07, 0x00, 0x12, 0x01, 0x83, 0x01, 0x03, 0x00, 0x05, 0x00, 0x26,
+    0x02, 0xFF, 0x81, 0xFE, 0x02, 0xF8, 0x08, 0xF0, 0x84, 0xF8, 0xFC, 0xFE, 0xFF, 0x00, 0x05, 0x01,
+    0x13, 0x00, 0x0B, 0x00, 0x97, 0x02, 0xFC, 0x04, 0xFE, 0x00, 0x11, 0x01, 0x82, 0x00, 0x0B, 0x00,
+    0x95, 0x12, 0x00, 0x00, 0x0C, 0x01, 0xBC, 0x01, 0x07, 0x00, 0x11, 0x01, 0x3C, 0x09, 0x00, 0x06,
+    0x1F, 0x03, 0x3F, 0x02, 0x7F, 0x02, 0xFD, 0x02, 0xF8, 0x83, 0xF0, 0xC0, 0x80, 0x16, 0x00, 0x07,
+    0xE0, 0x03, 0xF0, 0x81, 0xF8, 0x02, 0xFC, 0x84, 0xFE, 0xFF, 0x7F, 0x3F, 0x02, 0x1F, 0x82, 0x07,
+    0x01, 0x0A, 0x00, 0x03, 0x01, 0x05, 0x00, 0x00, 0x16, 0x01, 0xBD, 0x81, 0x1F, 0x06, 0x00, 0x81,
+    0xE0, 0x05, 0xFF, 0x83, 0x7F, 0x0F, 0x01, 0x11, 0x00, 0x82, 0x07, 0x1F, 0x05, 0xFF, 0x81, 0xF0,
+    0x08, 0x00, 0x84, 0xC0, 0xF0, 0xF8, 0xFC, 0x05, 0xFF, 0x02, 0x3F, 0x03, 0x1F, 0x00, 0x08, 0x01,
+    0x7D, 0x00, 0x07, 0x02, 0x03, 0x82, 0xE0, 0x80, 0x0F, 0x00, 0x02, 0x80, 0x03, 0xC0, 0x09, 0xE0,
+    0x01, 0xC0, 0x00, 0x0E, 0x01, 0x7C,
     // Character 52 (0x34) (4)
     // ----------------------------------------
     // ----------------------------------------
@@ -548,13 +547,13 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x17, 0x00, 0x81, 0x80, 0x07, 0xE0, 0x1C, 0x00, 0x84, 0xC0, 0xE0, 0xFC, 0xFE, 0x08, 0xFF, 0x18,
-    0x00, 0x84, 0x80, 0xF0, 0xFC, 0xFE, 0x02, 0xFF, 0x84, 0x1F, 0x0F, 0x03, 0x00, 0x06, 0xFF, 0x14,
-    0x00, 0x83, 0xC0, 0xF0, 0xF8, 0x02, 0xFF, 0x84, 0x7F, 0x3F, 0x0F, 0x01, 0x05, 0x00, 0x06, 0xFF,
-    0x10, 0x00, 0x83, 0xC0, 0xE0, 0xFC, 0x02, 0xFF, 0x84, 0x7F, 0x3F, 0x07, 0x03, 0x09, 0x00, 0x06,
-    0xFF, 0x0C, 0x00, 0x83, 0x80, 0xF0, 0xFC, 0x03, 0xFF, 0x83, 0x1F, 0x0F, 0x01, 0x0D, 0x00, 0x06,
-    0xFF, 0x0A, 0x00, 0x81, 0xFE, 0x05, 0xFF, 0x81, 0xFD, 0x11, 0xFC, 0x06, 0xFF, 0x08, 0xFC, 0x02,
-    0x00, 0x18, 0x03, 0x06, 0xFF, 0x08, 0x03, 0x1A, 0x00, 0x06, 0xFF, 0x22, 0x00, 0x06, 0x03, 0x09,
+    0x17, 0x00, 0x81, 0x01, 0x07, 0x07, 0x1C, 0x00, 0x84, 0x03, 0x07, 0x3F, 0x7F, 0x08, 0xFF, 0x18,
+    0x00, 0x84, 0x01, 0x0F, 0x3F, 0x7F, 0x02, 0xFF, 0x84, 0xF8, 0xF0, 0xC0, 0x00, 0x06, 0xFF, 0x14,
+    0x00, 0x83, 0x03, 0x0F, 0x1F, 0x02, 0xFF, 0x84, 0xFE, 0xFC, 0xF0, 0x80, 0x05, 0x00, 0x06, 0xFF,
+    0x10, 0x00, 0x83, 0x03, 0x07, 0x3F, 0x02, 0xFF, 0x84, 0xFE, 0xFC, 0xE0, 0xC0, 0x09, 0x00, 0x06,
+    0xFF, 0x0C, 0x00, 0x83, 0x01, 0x0F, 0x3F, 0x03, 0xFF, 0x83, 0xF8, 0xF0, 0x80, 0x0D, 0x00, 0x06,
+    0xFF, 0x0A, 0x00, 0x81, 0x7F, 0x05, 0xFF, 0x81, 0xBF, 0x11, 0x3F, 0x06, 0xFF, 0x08, 0x3F, 0x02,
+    0x00, 0x18, 0xC0, 0x06, 0xFF, 0x08, 0xC0, 0x1A, 0x00, 0x06, 0xFF, 0x22, 0x00, 0x06, 0xC0, 0x09,
     0x00,
     // Character 53 (0x35) (5)
     // ----------------------------------------
@@ -637,15 +636,15 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x06, 0x00, 0x1C, 0xE0, 0x0C, 0x00, 0x06, 0xFF, 0x16, 0x1F, 0x0B, 0x00, 0x81, 0xF8, 0x05, 0xFF,
-    0x81, 0x07, 0x21, 0x00, 0x06, 0xFF, 0x03, 0x00, 0x81, 0x80, 0x03, 0xC0, 0x07, 0xE0, 0x03, 0xC0,
-    0x81, 0x80, 0x0F, 0x00, 0x81, 0xFC, 0x06, 0xFF, 0x83, 0xFE, 0xFF, 0x7F, 0x02, 0x3F, 0x07, 0x1F,
-    0x02, 0x3F, 0x81, 0x7F, 0x05, 0xFF, 0x84, 0xFC, 0xF8, 0xF0, 0xC0, 0x09, 0x00, 0x07, 0x03, 0x81,
-    0x01, 0x0F, 0x00, 0x84, 0x01, 0x03, 0x1F, 0x7F, 0x05, 0xFF, 0x81, 0xC0, 0x22, 0x00, 0x06, 0xFF,
-    0x06, 0x00, 0x81, 0x0C, 0x02, 0xFC, 0x03, 0xFE, 0x83, 0xF8, 0xE0, 0x80, 0x0F, 0x00, 0x83, 0x80,
-    0xC0, 0xF8, 0x05, 0xFF, 0x81, 0x7F, 0x08, 0x00, 0x85, 0x01, 0x07, 0x1F, 0x3F, 0x7F, 0x04, 0xFF,
-    0x81, 0xFE, 0x02, 0xFC, 0x07, 0xF8, 0x02, 0xFC, 0x81, 0xFE, 0x03, 0xFF, 0x02, 0x7F, 0x84, 0x1F,
-    0x0F, 0x07, 0x01, 0x10, 0x00, 0x81, 0x01, 0x03, 0x03, 0x09, 0x07, 0x02, 0x03, 0x03, 0x01, 0x0B,
+    0x06, 0x00, 0x1C, 0x07, 0x0C, 0x00, 0x06, 0xFF, 0x16, 0xF8, 0x0B, 0x00, 0x81, 0x1F, 0x05, 0xFF,
+    0x81, 0xE0, 0x21, 0x00, 0x06, 0xFF, 0x03, 0x00, 0x81, 0x01, 0x03, 0x03, 0x07, 0x07, 0x03, 0x03,
+    0x81, 0x01, 0x0F, 0x00, 0x81, 0x3F, 0x06, 0xFF, 0x83, 0x7F, 0xFF, 0xFE, 0x02, 0xFC, 0x07, 0xF8,
+    0x02, 0xFC, 0x81, 0xFE, 0x05, 0xFF, 0x84, 0x3F, 0x1F, 0x0F, 0x03, 0x09, 0x00, 0x07, 0xC0, 0x81,
+    0x80, 0x0F, 0x00, 0x84, 0x80, 0xC0, 0xF8, 0xFE, 0x05, 0xFF, 0x81, 0x03, 0x22, 0x00, 0x06, 0xFF,
+    0x06, 0x00, 0x81, 0x30, 0x02, 0x3F, 0x03, 0x7F, 0x83, 0x1F, 0x07, 0x01, 0x0F, 0x00, 0x83, 0x01,
+    0x03, 0x1F, 0x05, 0xFF, 0x81, 0xFE, 0x08, 0x00, 0x85, 0x80, 0xE0, 0xF8, 0xFC, 0xFE, 0x04, 0xFF,
+    0x81, 0x7F, 0x02, 0x3F, 0x07, 0x1F, 0x02, 0x3F, 0x81, 0x7F, 0x03, 0xFF, 0x02, 0xFE, 0x84, 0xF8,
+    0xF0, 0xE0, 0x80, 0x10, 0x00, 0x81, 0x80, 0x03, 0xC0, 0x09, 0xE0, 0x02, 0xC0, 0x03, 0x80, 0x0B,
     0x00,
     // Character 54 (0x36) (6)
     // ----------------------------------------
@@ -728,19 +727,18 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x0D, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x02, 0xE0, 0x08, 0xF0, 0x02, 0xE0, 0x81, 0xC0, 0x02, 0x80,
-    0x10, 0x00, 0x84, 0x80, 0xC0, 0xF8, 0xFC, 0x03, 0xFF, 0x82, 0x7F, 0x3F, 0x03, 0x1F, 0x05, 0x0F,
-    0x02, 0x1F, 0x81, 0x7F, 0x04, 0xFF, 0x84, 0xFE, 0xFC, 0xF8, 0xC0, 0x0A, 0x00, 0x82, 0xC0, 0xFE,
-    0x04, 0xFF, 0x83, 0x0F, 0x07, 0x01, 0x0E, 0x00, 0x81, 0x01, 0x02, 0x0F, 0x04, 0x07, 0x81, 0x06,
-    0x08, 0x00, 0x81, 0xFC, 0x04, 0xFF, 0x82, 0x7F, 0x03, 0x03, 0x00, 0x02, 0x80, 0x03, 0xC0, 0x07,
-    0xE0, 0x02, 0xC0, 0x81, 0x80, 0x0F, 0x00, 0x05, 0xFF, 0x86, 0xC0, 0xF0, 0xFC, 0xFE, 0xFF, 0x7F,
-    0x02, 0x3F, 0x07, 0x1F, 0x02, 0x3F, 0x05, 0xFF, 0x02, 0xFC, 0x82, 0xF8, 0xC0, 0x09, 0x00, 0x06,
-    0xFF, 0x83, 0x3F, 0x03, 0x01, 0x0F, 0x00, 0x83, 0x01, 0x0F, 0x7F, 0x05, 0xFF, 0x81, 0xC0, 0x07,
-    0x00, 0x81, 0x7F, 0x05, 0xFF, 0x81, 0xC0, 0x14, 0x00, 0x06, 0xFF, 0x08, 0x00, 0x82, 0x07, 0x7F,
-    0x04, 0xFF, 0x83, 0xF0, 0xE0, 0xC0, 0x0E, 0x00, 0x82, 0xC0, 0xF8, 0x05, 0xFF, 0x82, 0x7F, 0x01,
-    0x0A, 0x00, 0x85, 0x01, 0x07, 0x1F, 0x3F, 0x7F, 0x03, 0xFF, 0x81, 0xFE, 0x02, 0xFC, 0x06, 0xF8,
-    0x02, 0xFC, 0x04, 0xFF, 0x85, 0x7F, 0x3F, 0x1F, 0x0F, 0x01, 0x12, 0x00, 0x02, 0x01, 0x02, 0x03,
-    0x08, 0x07, 0x02, 0x03, 0x02, 0x01, 0x0B, 0x00,
+    0x03, 0x00, 0x00, 0x0F, 0x03, 0x33, 0x00, 0x0B, 0x03, 0x2F, 0x01, 0x01, 0x00, 0x12, 0x03, 0x2F,
+    0x83, 0x03, 0x1F, 0x3F, 0x00, 0x05, 0x02, 0xA6, 0x03, 0xF8, 0x05, 0xF0, 0x01, 0xF8, 0x00, 0x06,
+    0x02, 0xD8, 0x84, 0x7F, 0x3F, 0x1F, 0x03, 0x0A, 0x00, 0x00, 0x06, 0x02, 0xEC, 0x01, 0xF0, 0x00,
+    0x10, 0x01, 0x42, 0x81, 0x80, 0x02, 0xF0, 0x04, 0xE0, 0x81, 0x60, 0x08, 0x00, 0x81, 0x3F, 0x04,
+    0xFF, 0x82, 0xFE, 0xC0, 0x03, 0x00, 0x01, 0x01, 0x00, 0x0D, 0x00, 0xC1, 0x81, 0x01, 0x0F, 0x00,
+    0x05, 0xFF, 0x83, 0x03, 0x0F, 0x3F, 0x00, 0x0E, 0x00, 0xBF, 0x00, 0x08, 0x01, 0x7B, 0x81, 0x03,
+    0x09, 0x00, 0x06, 0xFF, 0x82, 0xFC, 0xC0, 0x00, 0x11, 0x00, 0xB9, 0x82, 0xF0, 0xFE, 0x00, 0x0D,
+    0x00, 0xB7, 0x01, 0xFE, 0x00, 0x1A, 0x00, 0xBD, 0x06, 0xFF, 0x08, 0x00, 0x82, 0xE0, 0xFE, 0x04,
+    0xFF, 0x83, 0x0F, 0x07, 0x03, 0x0E, 0x00, 0x82, 0x03, 0x1F, 0x05, 0xFF, 0x82, 0xFE, 0x80, 0x02,
+    0x00, 0x00, 0x10, 0x00, 0xBC, 0x00, 0x09, 0x00, 0xB6, 0x01, 0x3F, 0x00, 0x06, 0x00, 0x5E, 0x01,
+    0xFC, 0x00, 0x10, 0x01, 0x5A, 0x05, 0x00, 0x02, 0x80, 0x00, 0x0D, 0x03, 0x2F, 0x81, 0x80, 0x0B,
+    0x00,
     // Character 55 (0x37) (7)
     // ----------------------------------------
     // ----------------------------------------
@@ -822,12 +820,12 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x04, 0x00, 0x20, 0xE0, 0x08, 0x00, 0x19, 0x1F, 0x81, 0xDF, 0x05, 0xFF, 0x81, 0x7F, 0x1D, 0x00,
-    0x84, 0x80, 0xF0, 0xFC, 0xFE, 0x02, 0xFF, 0x83, 0x7F, 0x1F, 0x07, 0x1B, 0x00, 0x83, 0x80, 0xC0,
-    0xF0, 0x04, 0xFF, 0x83, 0x7F, 0x0F, 0x03, 0x1C, 0x00, 0x82, 0xE0, 0xF8, 0x04, 0xFF, 0x83, 0x7F,
-    0x07, 0x01, 0x1C, 0x00, 0x83, 0x80, 0xF0, 0xFC, 0x04, 0xFF, 0x82, 0x3F, 0x03, 0x1E, 0x00, 0x81,
-    0xF0, 0x05, 0xFF, 0x82, 0x0F, 0x01, 0x1F, 0x00, 0x06, 0xFF, 0x81, 0x0F, 0x20, 0x00, 0x81, 0xFC,
-    0x05, 0xFF, 0x81, 0x03, 0x21, 0x00, 0x06, 0x03, 0x15, 0x00,
+    0x04, 0x00, 0x20, 0x07, 0x08, 0x00, 0x19, 0xF8, 0x81, 0xFB, 0x05, 0xFF, 0x81, 0xFE, 0x1D, 0x00,
+    0x84, 0x01, 0x0F, 0x3F, 0x7F, 0x02, 0xFF, 0x83, 0xFE, 0xF8, 0xE0, 0x1B, 0x00, 0x83, 0x01, 0x03,
+    0x0F, 0x04, 0xFF, 0x83, 0xFE, 0xF0, 0xC0, 0x1C, 0x00, 0x82, 0x07, 0x1F, 0x04, 0xFF, 0x83, 0xFE,
+    0xE0, 0x80, 0x1C, 0x00, 0x83, 0x01, 0x0F, 0x3F, 0x04, 0xFF, 0x82, 0xFC, 0xC0, 0x1E, 0x00, 0x81,
+    0x0F, 0x05, 0xFF, 0x82, 0xF0, 0x80, 0x1F, 0x00, 0x06, 0xFF, 0x81, 0xF0, 0x20, 0x00, 0x81, 0x3F,
+    0x05, 0xFF, 0x81, 0xC0, 0x21, 0x00, 0x06, 0xC0, 0x15, 0x00,
     // Character 56 (0x38) (8)
     // ----------------------------------------
     // ----------------------------------------
@@ -909,20 +907,18 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x0A, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x03, 0xE0, 0x08, 0xF0, 0x03, 0xE0, 0x02, 0xC0, 0x81, 0x80,
-    0x0F, 0x00, 0x84, 0x80, 0xF0, 0xFC, 0xFE, 0x04, 0xFF, 0x81, 0x7F, 0x02, 0x1F, 0x08, 0x0F, 0x02,
-    0x1F, 0x81, 0x7F, 0x04, 0xFF, 0x84, 0xFE, 0xFC, 0xF0, 0x80, 0x09, 0x00, 0x81, 0xFC, 0x06, 0xFF,
-    0x81, 0x01, 0x10, 0x00, 0x81, 0x01, 0x06, 0xFF, 0x81, 0xFC, 0x08, 0x00, 0x82, 0x03, 0x1F, 0x05,
-    0xFF, 0x83, 0xE0, 0xC0, 0x80, 0x0C, 0x00, 0x83, 0x80, 0xC0, 0xE0, 0x05, 0xFF, 0x82, 0x1F, 0x03,
-    0x0B, 0x00, 0x85, 0x03, 0x07, 0x0F, 0x9F, 0xBF, 0x03, 0xFF, 0x81, 0xFE, 0x08, 0xFC, 0x02, 0xFE,
-    0x02, 0xFF, 0x02, 0x9F, 0x83, 0x0F, 0x07, 0x03, 0x0B, 0x00, 0x82, 0xC0, 0xF0, 0x02, 0xFC, 0x81,
-    0xFE, 0x02, 0xFF, 0x83, 0x3F, 0x1F, 0x0F, 0x02, 0x07, 0x08, 0x03, 0x02, 0x07, 0x81, 0x0F, 0x02,
-    0x1F, 0x02, 0xFF, 0x02, 0xFE, 0x83, 0xFC, 0xF0, 0xC0, 0x07, 0x00, 0x81, 0xFC, 0x05, 0xFF, 0x81,
-    0x07, 0x14, 0x00, 0x81, 0x03, 0x05, 0xFF, 0x81, 0xFC, 0x06, 0x00, 0x81, 0x0F, 0x05, 0xFF, 0x83,
-    0xFC, 0xE0, 0x80, 0x11, 0x00, 0x82, 0xE0, 0xFC, 0x05, 0xFF, 0x81, 0x0F, 0x07, 0x00, 0x85, 0x01,
-    0x07, 0x1F, 0x3F, 0x7F, 0x04, 0xFF, 0x81, 0xFE, 0x02, 0xFC, 0x08, 0xF8, 0x02, 0xFC, 0x81, 0xFE,
-    0x04, 0xFF, 0x85, 0x7F, 0x3F, 0x1F, 0x07, 0x01, 0x0F, 0x00, 0x81, 0x01, 0x04, 0x03, 0x08, 0x07,
-    0x04, 0x03, 0x81, 0x01, 0x0B, 0x00,
+    0x00, 0x1A, 0x04, 0x3C, 0x01, 0x07, 0x00, 0x12, 0x04, 0x36, 0x00, 0x06, 0x02, 0x06, 0x00, 0x0E,
+    0x02, 0xB1, 0x00, 0x06, 0x03, 0xD7, 0x85, 0x7F, 0x3F, 0x0F, 0x01, 0x00, 0x00, 0x0D, 0x00, 0xEC,
+    0x02, 0xFF, 0x81, 0x80, 0x0F, 0x00, 0x00, 0x0B, 0x03, 0x41, 0x06, 0x00, 0x82, 0xC0, 0xF8, 0x05,
+    0xFF, 0x83, 0x07, 0x03, 0x01, 0x02, 0x00, 0x00, 0x0C, 0x04, 0x73, 0x01, 0x07, 0x00, 0x11, 0x03,
+    0xF3, 0x86, 0x00, 0xC0, 0xE0, 0xF0, 0xF9, 0xFD, 0x00, 0x06, 0x03, 0xF1, 0x04, 0x3F, 0x00, 0x06,
+    0x03, 0xEF, 0x02, 0xF9, 0x00, 0x0D, 0x03, 0x3D, 0x83, 0x00, 0x03, 0x0F, 0x00, 0x05, 0x01, 0x82,
+    0x83, 0xFC, 0xF8, 0xF0, 0x02, 0xE0, 0x08, 0xC0, 0x02, 0xE0, 0x81, 0xF0, 0x02, 0xF8, 0x02, 0xFF,
+    0x02, 0x7F, 0x83, 0x3F, 0x0F, 0x03, 0x07, 0x00, 0x01, 0x3F, 0x00, 0x1A, 0x02, 0x08, 0x81, 0xC0,
+    0x05, 0xFF, 0x81, 0x3F, 0x06, 0x00, 0x81, 0xF0, 0x05, 0xFF, 0x01, 0x3F, 0x00, 0x0C, 0x02, 0xE1,
+    0x07, 0x00, 0x82, 0x07, 0x3F, 0x00, 0x0D, 0x02, 0xCC, 0x00, 0x13, 0x01, 0xCD, 0x01, 0x1F, 0x00,
+    0x06, 0x01, 0xC5, 0x84, 0xFF, 0xFE, 0xFC, 0xF8, 0x00, 0x12, 0x02, 0xC6, 0x02, 0xC0, 0x00, 0x0C,
+    0x04, 0x3F, 0x00, 0x0E, 0x04, 0x3F,
     // Character 57 (0x39) (9)
     // ----------------------------------------
     // ----------------------------------------
@@ -1004,19 +1000,18 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------------------------------
     // ----------------------------------------
     // ----------------------------------------
-    0x0A, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x03, 0xE0, 0x08, 0xF0, 0x02, 0xE0, 0x81, 0xC0, 0x02, 0x80,
-    0x0F, 0x00, 0x85, 0x80, 0xC0, 0xF8, 0xFC, 0xFE, 0x03, 0xFF, 0x02, 0x7F, 0x02, 0x1F, 0x06, 0x0F,
-    0x02, 0x1F, 0x82, 0x3F, 0x7F, 0x03, 0xFF, 0x85, 0xFE, 0xFC, 0xF0, 0xE0, 0x80, 0x09, 0x00, 0x81,
-    0xE0, 0x05, 0xFF, 0x82, 0x7F, 0x0F, 0x10, 0x00, 0x82, 0x03, 0x07, 0x05, 0xFF, 0x82, 0xF0, 0x80,
-    0x07, 0x00, 0x06, 0xFF, 0x81, 0x80, 0x14, 0x00, 0x06, 0xFF, 0x07, 0x00, 0x82, 0x01, 0x7F, 0x05,
-    0xFF, 0x82, 0xFC, 0xE0, 0x02, 0x80, 0x0C, 0x00, 0x84, 0x80, 0xC0, 0xE0, 0xFE, 0x06, 0xFF, 0x09,
-    0x00, 0x84, 0x01, 0x07, 0x0F, 0x1F, 0x02, 0x7F, 0x03, 0xFF, 0x02, 0xFE, 0x06, 0xFC, 0x02, 0xFE,
-    0x83, 0xFF, 0x7F, 0x3F, 0x02, 0x1F, 0x82, 0x03, 0xC1, 0x05, 0xFF, 0x10, 0x00, 0x02, 0x01, 0x07,
-    0x03, 0x03, 0x01, 0x05, 0x00, 0x81, 0xF0, 0x05, 0xFF, 0x81, 0x1F, 0x08, 0x00, 0x04, 0xF0, 0x02,
-    0xF8, 0x82, 0xF0, 0x80, 0x0D, 0x00, 0x84, 0x80, 0xE0, 0xF0, 0xFC, 0x03, 0xFF, 0x83, 0x7F, 0x3F,
-    0x01, 0x09, 0x00, 0x85, 0x01, 0x03, 0x1F, 0x3F, 0x7F, 0x04, 0xFF, 0x81, 0xFE, 0x02, 0xFC, 0x05,
-    0xF8, 0x02, 0xFC, 0x81, 0xFE, 0x03, 0xFF, 0x85, 0x7F, 0x3F, 0x1F, 0x0F, 0x01, 0x12, 0x00, 0x81,
-    0x01, 0x03, 0x03, 0x08, 0x07, 0x02, 0x03, 0x02, 0x01, 0x0E, 0x00,
+    0x00, 0x1B, 0x04, 0xF2, 0x02, 0x01, 0x00, 0x12, 0x01, 0xFC, 0x01, 0x3F, 0x00, 0x07, 0x01, 0xE6,
+    0x81, 0xF8, 0x06, 0xF0, 0x01, 0xF8, 0x00, 0x04, 0x03, 0x67, 0x02, 0xFF, 0x83, 0x7F, 0x3F, 0x0F,
+    0x00, 0x0B, 0x03, 0x2B, 0x82, 0x07, 0xFF, 0x00, 0x06, 0x01, 0x16, 0x10, 0x00, 0x82, 0xC0, 0xE0,
+    0x05, 0xFF, 0x82, 0x0F, 0x01, 0x07, 0x00, 0x01, 0xFF, 0x00, 0x19, 0x04, 0xC3, 0x81, 0x00, 0x06,
+    0xFF, 0x02, 0x00, 0x00, 0x0C, 0x04, 0xD2, 0x82, 0x3F, 0x07, 0x02, 0x01, 0x02, 0x00, 0x00, 0x0C,
+    0x05, 0x40, 0x82, 0x07, 0x7F, 0x06, 0xFF, 0x01, 0x00, 0x00, 0x0A, 0x02, 0x45, 0x82, 0xF0, 0xF8,
+    0x00, 0x06, 0x04, 0xC1, 0x81, 0x7F, 0x04, 0x3F, 0x00, 0x05, 0x04, 0xBF, 0x82, 0xFE, 0xFC, 0x02,
+    0xF8, 0x82, 0xC0, 0x83, 0x05, 0xFF, 0x01, 0x00, 0x00, 0x14, 0x03, 0x49, 0x02, 0xC0, 0x00, 0x0A,
+    0x02, 0x45, 0x81, 0x0F, 0x05, 0xFF, 0x81, 0xF8, 0x08, 0x00, 0x04, 0x0F, 0x02, 0x1F, 0x00, 0x09,
+    0x00, 0x5C, 0x06, 0x00, 0x84, 0x01, 0x07, 0x0F, 0x3F, 0x00, 0x05, 0x04, 0xEC, 0x81, 0x80, 0x09,
+    0x00, 0x82, 0x80, 0xC0, 0x00, 0x04, 0x03, 0xF5, 0x00, 0x0E, 0x05, 0x07, 0x00, 0x05, 0x04, 0xFF,
+    0x00, 0x10, 0x03, 0x2A, 0x05, 0x00, 0x00, 0x0C, 0x02, 0x83, 0x02, 0xC0, 0x02, 0x80, 0x0E, 0x00,
     // Character 58 (0x3A) (:)
     // ----------------
     // ----------------
@@ -1098,6 +1093,6 @@ const uint8_t clock_number_font[] PROGMEM = {
     // ----------------
     // ----------------
     // ----------------
-    0x23, 0x00, 0x09, 0xF8, 0x07, 0x00, 0x09, 0xFF, 0x07, 0x00, 0x09, 0x03, 0x27, 0x00, 0x09, 0xF8,
-    0x07, 0x00, 0x09, 0xFF, 0x07, 0x00, 0x09, 0x03, 0x04, 0x00,
+    0x23, 0x00, 0x09, 0x1F, 0x07, 0x00, 0x09, 0xFF, 0x07, 0x00, 0x09, 0xC0, 0x27, 0x00, 0x09, 0x1F,
+    0x07, 0x00, 0x09, 0xFF, 0x07, 0x00, 0x09, 0xC0, 0x04, 0x00,
 };
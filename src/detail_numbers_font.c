@@ -4,24 +4,25 @@
 #include <avr/pgmspace.h> 
 
 const uint8_t detail_numbers_font[] PROGMEM = {
-    0x56, 0x41, 0x52, 0x31,  // id: VAR1
-    0x0D, // num_chars
-    0x03, // height
+    0x56, 0x41, 0x52, 0x32,  // id: VAR2
+    0x0E, // num_chars
+    0x83, // height | VARIABLE_FONT_REVERSED
 
     // Character offsets
-    ' ', 12, 0x00, 0x34,  // off=52
-    '-', 12, 0x00, 0x36,  // off=54
-    '.', 12, 0x00, 0x3C,  // off=60
-    '0', 12, 0x00, 0x42,  // off=66
-    '1', 12, 0x00, 0x69,  // off=105
-    '2', 12, 0x00, 0x81,  // off=129
+    0, 0, 0x30, 10,  // dense index 0-9
+    ' ', 12, 0x00, 0x38,  // off=56
+    '-', 12, 0x00, 0x3A,  // off=58
+    '.', 12, 0x00, 0x40,  // off=64
+    '0', 12, 0x00, 0x46,  // off=70
+    '1', 12, 0x00, 0x6D,  // off=109
+    '2', 12, 0x00, 0x85,  // off=133
     '3', 12, 0x00, 0xA1,  // off=161
     '4', 12, 0x00, 0xC8,  // off=200
     '5', 12, 0x00, 0xE2,  // off=226
-    '6', 12, 0x01, 0x01,  // off=257
-    '7', 12, 0x01, 0x29,  // off=297
-    '8', 12, 0x01, 0x3F,  // off=319
-    '9', 12, 0x01, 0x64,  // off=356
+    '6', 12, 0x00, 0xFD,  // off=253
+    '7', 12, 0x01, 0x19,  // off=281
+    '8', 12, 0x01, 0x2F,  // off=303
+    '9', 12, 0x01, 0x46,  // off=326
     // Character data
     // Character 32 (0x20) ( )
     // ------------
@@ -74,7 +75,7 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x0E, 0x00, 0x07, 0x30, 0x0F, 0x00,
+    0x0E, 0x00, 0x07, 0x0C, 0x0F, 0x00,
     // Character 46 (0x2E) (.)
     // ------------
     // ------------
@@ -100,7 +101,7 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x1C, 0x00, 0x03, 0x07, 0x05, 0x00,
+    0x1C, 0x00, 0x03, 0xE0, 0x05, 0x00,
     // Character 48 (0x30) (0)
     // ------------
     // ------------
@@ -126,9 +127,9 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x84, 0x00, 0x80, 0xC0, 0xE0, 0x03, 0x60, 0x83, 0xE0, 0xC0, 0x80, 0x02, 0x00, 0x03, 0xFF, 0x81,
-    0x00, 0x03, 0x1C, 0x81, 0x00, 0x02, 0xFF, 0x81, 0x7F, 0x02, 0x00, 0x83, 0x01, 0x03, 0x07, 0x03,
-    0x06, 0x83, 0x07, 0x03, 0x01, 0x02, 0x00,
+    0x84, 0x00, 0x01, 0x03, 0x07, 0x03, 0x06, 0x83, 0x07, 0x03, 0x01, 0x02, 0x00, 0x03, 0xFF, 0x81,
+    0x00, 0x03, 0x38, 0x81, 0x00, 0x02, 0xFF, 0x81, 0xFE, 0x02, 0x00, 0x83, 0x80, 0xC0, 0xE0, 0x03,
+    0x60, 0x83, 0xE0, 0xC0, 0x80, 0x02, 0x00,
     // Character 49 (0x31) (1)
     // ------------
     // ------------
@@ -154,8 +155,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x02, 0x80, 0x02, 0xC0, 0x03, 0xE0, 0x05, 0x00, 0x02, 0x01, 0x02, 0x00, 0x03, 0xFF, 0x05, 0x00,
-    0x04, 0x06, 0x03, 0x07, 0x04, 0x06, 0x01, 0x00,
+    0x02, 0x01, 0x02, 0x03, 0x03, 0x07, 0x05, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0xFF, 0x05, 0x00,
+    0x04, 0x60, 0x03, 0xE0, 0x04, 0x60, 0x01, 0x00,
     // Character 50 (0x32) (2)
     // ------------
     // ------------
@@ -181,8 +182,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x82, 0x80, 0xC0, 0x02, 0xE0, 0x03, 0x60, 0x83, 0xE0, 0xC0, 0x80, 0x02, 0x00, 0x8A, 0x01, 0x81,
-    0xC1, 0xE0, 0x70, 0x38, 0x3C, 0x1F, 0x0F, 0x07, 0x02, 0x00, 0x03, 0x07, 0x07, 0x06, 0x02, 0x00,
+    0x82, 0x01, 0x03, 0x02, 0x07, 0x00, 0x08, 0x00, 0x3F, 0x8A, 0x80, 0x81, 0x83, 0x07, 0x0E, 0x1C,
+    0x3C, 0xF8, 0xF0, 0xE0, 0x02, 0x00, 0x03, 0xE0, 0x07, 0x60, 0x02, 0x00,
     // Character 51 (0x33) (3)
     // ------------
     // ------------
@@ -208,9 +209,9 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x81, 0x80, 0x02, 0xC0, 0x81, 0xE0, 0x03, 0x60, 0x02, 0xE0, 0x83, 0xC0, 0x80, 0x00, 0x03, 0x81,
-    0x81, 0x00, 0x03, 0x18, 0x86, 0x3C, 0xFF, 0xE7, 0xE3, 0x00, 0x01, 0x02, 0x03, 0x81, 0x07, 0x03,
-    0x06, 0x02, 0x07, 0x83, 0x03, 0x01, 0x00,
+    0x81, 0x01, 0x02, 0x03, 0x81, 0x07, 0x03, 0x06, 0x02, 0x07, 0x83, 0x03, 0x01, 0x00, 0x03, 0x81,
+    0x81, 0x00, 0x03, 0x18, 0x86, 0x3C, 0xFF, 0xE7, 0xC7, 0x00, 0x80, 0x02, 0xC0, 0x81, 0xE0, 0x03,
+    0x60, 0x02, 0xE0, 0x83, 0xC0, 0x80, 0x00,
     // Character 52 (0x34) (4)
     // ------------
     // ------------
@@ -236,8 +237,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x05, 0x00, 0x81, 0xC0, 0x04, 0xE0, 0x02, 0x00, 0x87, 0xE0, 0xF0, 0xF8, 0xDE, 0xC7, 0xC3, 0xC1,
-    0x03, 0xFF, 0x02, 0xC0, 0x07, 0x00, 0x03, 0x07, 0x02, 0x00,
+    0x05, 0x00, 0x81, 0x03, 0x04, 0x07, 0x02, 0x00, 0x87, 0x07, 0x0F, 0x1F, 0x7B, 0xE3, 0xC3, 0x83,
+    0x03, 0xFF, 0x02, 0x03, 0x07, 0x00, 0x03, 0xE0, 0x02, 0x00,
     // Character 53 (0x35) (5)
     // ------------
     // ------------
@@ -263,8 +264,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x03, 0xE0, 0x07, 0x60, 0x02, 0x00, 0x03, 0x9F, 0x81, 0x18, 0x03, 0x0C, 0x86, 0x1C, 0xFC, 0xF8,
-    0xF0, 0x00, 0x01, 0x02, 0x03, 0x81, 0x07, 0x03, 0x06, 0x81, 0x07, 0x02, 0x03, 0x02, 0x00,
+    0x03, 0x07, 0x07, 0x06, 0x02, 0x00, 0x03, 0xF9, 0x81, 0x18, 0x03, 0x30, 0x86, 0x38, 0x3F, 0x1F,
+    0x0F, 0x00, 0x80, 0x00, 0x07, 0x00, 0x39, 0x02, 0xC0, 0x02, 0x00,
     // Character 54 (0x36) (6)
     // ------------
     // ------------
@@ -290,9 +291,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x84, 0x00, 0x80, 0xC0, 0xE0, 0x03, 0x60, 0x02, 0xE0, 0x84, 0xC0, 0x80, 0x00, 0x7E, 0x02, 0xFF,
-    0x81, 0x18, 0x03, 0x0C, 0x84, 0x1C, 0xFD, 0xF9, 0xF1, 0x02, 0x00, 0x83, 0x01, 0x03, 0x07, 0x03,
-    0x06, 0x81, 0x07, 0x02, 0x03, 0x82, 0x01, 0x00,
+    0x00, 0x08, 0x00, 0xB7, 0x00, 0x04, 0x00, 0xB4, 0x81, 0x7E, 0x02, 0xFF, 0x00, 0x05, 0x00, 0x1F,
+    0x83, 0xBF, 0x9F, 0x8F, 0x00, 0x0A, 0x00, 0xB2, 0x83, 0xC0, 0x80, 0x00,
     // Character 55 (0x37) (7)
     // ------------
     // ------------
@@ -318,8 +318,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x08, 0x60, 0x02, 0xE0, 0x81, 0x60, 0x04, 0x00, 0x87, 0xE0, 0xF8, 0xFC, 0x1E, 0x07, 0x03, 0x01,
-    0x04, 0x00, 0x03, 0x07, 0x07, 0x00,
+    0x08, 0x06, 0x02, 0x07, 0x81, 0x06, 0x04, 0x00, 0x87, 0x07, 0x1F, 0x3F, 0x78, 0xE0, 0xC0, 0x80,
+    0x04, 0x00, 0x03, 0xE0, 0x07, 0x00,
     // Character 56 (0x38) (8)
     // ------------
     // ------------
@@ -345,9 +345,8 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x82, 0x80, 0xC0, 0x02, 0xE0, 0x03, 0x60, 0x02, 0xE0, 0x87, 0xC0, 0x80, 0x00, 0xE3, 0xE7, 0xFF,
-    0x3C, 0x03, 0x18, 0x87, 0x3C, 0xFF, 0xE7, 0xE3, 0x00, 0x01, 0x03, 0x02, 0x07, 0x03, 0x06, 0x02,
-    0x07, 0x83, 0x03, 0x01, 0x00,
+    0x00, 0x04, 0x00, 0xAA, 0x00, 0x08, 0x00, 0x8C, 0x84, 0xC7, 0xE7, 0xFF, 0x3C, 0x00, 0x0A, 0x00,
+    0x89, 0x01, 0xE0, 0x00, 0x09, 0x00, 0x84,
     // Character 57 (0x39) (9)
     // ------------
     // ------------
@@ -373,7 +372,7 @@ const uint8_t detail_numbers_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x81, 0x80, 0x02, 0xC0, 0x81, 0xE0, 0x03, 0x60, 0x83, 0xE0, 0xC0, 0x80, 0x02, 0x00, 0x84, 0x8F,
-    0x9F, 0xBF, 0x38, 0x03, 0x30, 0x81, 0x18, 0x02, 0xFF, 0x84, 0x7F, 0x00, 0x01, 0x03, 0x02, 0x07,
-    0x03, 0x06, 0x83, 0x07, 0x03, 0x01, 0x02, 0x00,
+    0x00, 0x08, 0x00, 0xA5, 0x82, 0x03, 0x01, 0x02, 0x00, 0x84, 0xF1, 0xF9, 0xFD, 0x1C, 0x03, 0x0C,
+    0x01, 0x18, 0x00, 0x04, 0x00, 0xFD, 0x83, 0x80, 0xC0, 0xE0, 0x00, 0x05, 0x00, 0xA2, 0x00, 0x04,
+    0x00, 0xA0,
 };
@@ -3,6 +3,7 @@
 #include <oledm/epaper.h>
 #include <oledm/text.h>
 #include <pstr/pstr.h>
+#include <spi/spi.h>
 
 #include <time.h>
 #include "clock_number_font.h"
@@ -12,10 +13,11 @@
 #include "labels_font.h"
 #include "pressure_font.h"
 #include "pressure_graph.h"
-#include "sun_moon_icons_light.h"
-#include "sun_moon_icons_dark.h"
+#include "sun_moon_icons.h"
 
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
 
 // This module is resposible for rendering time/weather data on the epaper display
 // It does not collect the data, only displays it.
@@ -33,7 +35,9 @@
 // UI Positioning constants.  These all assume a 296x128 (16 row) display.
 //
 
-#define AM_PM_COLUMN 173
+// Just past the 12h time, including the blank columns of its last digit, so
+// a new minute does not draw over AM/PM.
+#define AM_PM_COLUMN 176
 #define AM_PM_ROW 7
 
 #define DATE_COLUMN 209
@@ -58,6 +62,50 @@
 
 #define GPS_STATS_ROW 10
 
+#define DISPLAY_COLUMNS 296
+
+//
+// Refresh policy.  Routine minute updates use a partial refresh, which is
+// much shorter than a full refresh and does not flash the panel.  Partial
+// refreshes slowly accumulate ghosting so a full refresh is forced when
+// any of the limits below is reached.  Each can be overridden in CFLAGS.
+//
+
+// Maximum number of partial refreshes in a row.  Set to 0 to go back to
+// always doing a full refresh.
+#ifndef PARTIALS_PER_FULL_REFRESH
+#define PARTIALS_PER_FULL_REFRESH 60
+#endif
+
+// Set to 1 to force a full refresh at the start of every hour.
+#ifndef FULL_REFRESH_HOURLY
+#define FULL_REFRESH_HOURLY 1
+#endif
+
+// Force a full refresh after this much area has been changed by partial
+// refreshes.  Units are 8x1 pixel memory cells.  The whole display is
+// 16 * 296 = 4736 cells and the clock widget alone is 2050, so the
+// default is roughly an hour of minute updates.  Set to 0 to disable.
+#ifndef FULL_REFRESH_CHANGED_AREA
+#define FULL_REFRESH_CHANGED_AREA 120000UL
+#endif
+
+// How the display sleeps between updates.  SLEEP_MODE_1 keeps the display
+// RAM, which is what allows partial refreshes that only send the widgets
+// that changed.  SLEEP_MODE_2 discards the RAM for a slightly lower sleep
+// current but then every update has to be a full refresh, which costs far
+// more time awake.  Measure the sleep current of your own build before
+// trading partial refreshes away for it.
+#ifndef DISPLAY_SLEEP_MODE
+#define DISPLAY_SLEEP_MODE SLEEP_MODE_1
+#endif
+
+// If non-zero, full refreshes use the panel's own waveform for the measured
+// temperature instead of the WS_20_30 waveform.  See epaper_set_temperature()
+#ifndef DISPLAY_TEMPERATURE_WAVEFORMS
+#define DISPLAY_TEMPERATURE_WAVEFORMS 0
+#endif
+
 //
 // Global Vars
 //
@@ -80,6 +128,9 @@ typedef enum {
   WANING_CRESCENT = 8,
 } StellarIcon;
 
+// The dark mode version of an icon is this many characters later
+#define DARK_MODE_ICONS 9
+
 
 // Calculating sunrise/sunset every minute is a waste of battery resources
 // we can just calculate it once per day and hold it in SRAM.
@@ -91,6 +142,59 @@ uint8_t sunset_hour;
 uint8_t sunset_minute;
 uint8_t moon_icon;
 
+// Partial refresh tracking.  See use_full_refresh()
+static uint8_t full_refresh_needed;
+static uint16_t partial_refresh_count;
+static uint8_t last_full_refresh_hour;
+static uint32_t changed_area;
+
+// Set by display_prepare() to what display_show() needs to do
+#define PREPARED_NONE 0
+#define PREPARED_PARTIAL 1
+#define PREPARED_FULL 2
+static uint8_t prepared_refresh;
+// A prepared frame can be dropped (e.g. a button press comes in before the
+// minute), thus the refresh tracking is only updated by display_show()
+static uint8_t prepared_hour;
+static uint16_t prepared_area;
+
+// The time that update_state() last ran for
+static time_t state_time_y2k;
+
+// Everything that widgets need to render themselves
+struct Frame {
+  struct tm t;
+  const struct DisplayInfo* dinfo;
+  uint8_t option_bits;  // from EEPromVars
+  // Pressure range from the graph's POV, widened to include the current
+  // pressure.
+  uint32_t min_pressure_pa;
+  uint32_t max_pressure_pa;
+};
+
+// A rectangular part of the display.  Bounds are inclusive.
+struct Widget {
+  column_t left_column;
+  uint8_t top_row;
+  column_t right_column;
+  uint8_t bottom_row;
+  uint8_t flags;  // WIDGET_*
+  // Returns a value that changes whenever the rendered output would change
+  uint16_t (*fingerprint)(const struct Frame* f);
+  void (*render)(const struct Frame* f);
+};
+
+#define ALL_WIDGETS 0xFFFF
+
+// Clear the whole widget before redrawing it.  Otherwise the widget is
+// expected to overwrite its old content and call erase_tail() for
+// anything it no longer covers.
+#define WIDGET_CLEAR 0x01
+
+// Erase tracking for the widget being rendered.  See erase_tail()
+static column_t erase_limit;
+static column_t widget_extent;
+
 //
 // Helpers - these should all be declared static
 //
@@ -114,6 +218,42 @@ static void render_u8_sp2(uint8_t v) {
 }
 
 
+// Fills a rectangle with a byte pattern.  Bounds are inclusive
+static void fill_area(
+    column_t left_column,
+    uint8_t top_row,
+    column_t right_column,
+    uint8_t bottom_row,
+    uint8_t byte) {
+  oledm_set_bounds(&display, left_column, top_row, right_column, bottom_row);
+
+  oledm_start_pixels(&display);
+  oledm_write_pixel_run(
+      &display,
+      byte,
+      (right_column - left_column + 1) * (bottom_row - top_row + 1));
+  oledm_stop(&display);
+}
+
+// The display RAM still holds the previous frame during a partial refresh
+// and text/graphs overwrite every cell they cover.  Thus the only thing
+// that needs erasing is whatever the old content had to the right of the
+// new content.  This erases from column to where the widget extended last
+// time (erase_limit) and records how far the widget extends now.
+static void erase_tail(column_t column, uint8_t top_row, uint8_t bottom_row) {
+  if (column > widget_extent) {
+    widget_extent = column;
+  }
+  if (column < erase_limit) {
+    fill_area(column, top_row, erase_limit - 1, bottom_row, 0x00);
+  }
+}
+
+// Calls erase_tail() for the line of text that was just rendered
+static void end_text_line(void) {
+  erase_tail(text.column, text.row, text.row + text_height(&text) - 1);
+}
+
 // Renders a number and units while trying to make use of space.
 // number columns is the number of available columns not including the units.
 //
@@ -164,17 +304,12 @@ static void render_i32x100(
 
   text.font = label_font;
   text_str(&text, units);
+  end_text_line();
 }
 
 // Draws a vertical line.  end_row is inclusive
 static void vline(column_t column, uint8_t start_row, uint8_t end_row) {
-  oledm_set_bounds(&display, column, start_row, column, end_row);
-
-  oledm_start_pixels(&display);
-  for (uint8_t row=start_row; row <= end_row; ++row) {
-    oledm_write_pixels(&display, 0xFF);
-  }
-  oledm_stop(&display);
+  fill_area(column, start_row, column, end_row, 0xFF);
 }
 
 // Renders either a 12h or 24h time to the display.
@@ -232,16 +367,21 @@ static void calc_sunrise_sunset(const time_t time_y2k) {
   sunset_minute = t.tm_min;
 }
 
-// converts current_time_ytk into a human-readable time and
-// renders it on the epaper display which is assumed to be
-// ready to accept commands.
-static void render_time(
+// Updates everything that changes over time (the pressure graph, sunrise,
+// moon phase).  A frame that was prepared ahead can be dropped for one drawn
+// a few seconds earlier, then prepared again.  Thus this only runs for times
+// after the last one it ran for, unless the clock was set back.
+static void update_state(
+    const struct tm* t,
     const time_t time_y2k,
     uint8_t position_was_set,
-    uint32_t pressure_pa,
-    const struct EEPromVars* eeprom) {
-  struct tm t;
-  localtime_r(&time_y2k, &t);
+    uint32_t pressure_pa) {
+  if (pressure_graph_has_data() &&
+      (time_y2k <= state_time_y2k) &&
+      ((state_time_y2k - time_y2k) < 60)) {
+    return;
+  }
+  state_time_y2k = time_y2k;
 
   if (!pressure_graph_has_data()) {
     // First call.  Initialize all points to the current value
@@ -249,159 +389,283 @@ static void render_time(
     for (column_t i=0; i<PRESSURE_GRAPH_COLS; ++i) {
       pressure_graph_add_point(pressure_pa);
     }
-  } else if ((t.tm_min % 10) == 0) {
+  } else {
+    pressure_graph_add_sample(pressure_pa);
+    if ((t->tm_min % 10) == 0) {
       pressure_graph_add_point(pressure_pa);
+    }
   }
 
-  const uint8_t use_24h_time = (eeprom->option_bits & OPTION_USE_24H_TIME);
-
   if (position_was_set &&
       ((sunrise_hour == 0) ||
-       ((t.tm_hour == SUNRISE_RECALC_HOUR) && (t.tm_min == SUNRISE_RECALC_MINUTE)))) {
+       ((t->tm_hour == SUNRISE_RECALC_HOUR) && (t->tm_min == SUNRISE_RECALC_MINUTE)))) {
     // Recalculate sunrise/sunset if they have never been set or if it's the trigger
     // point for the current day (currently 12:01 AM but check the constants to
     // be sure about that.)
     calc_sunrise_sunset(time_y2k);
     recalc_moon_phase(time_y2k);
   }
+}
+
+// Decides between a partial and a full refresh.  area is the number of
+// memory cells that a partial refresh would change.  The tracking variables
+// are left alone, see commit_refresh().
+static uint8_t use_full_refresh(const struct tm* t, uint16_t area) {
+  if (full_refresh_needed) {
+    return 1;
+  }
+  if (!epaper_ram_is_retained(&display)) {
+    // Nothing to compare against
+    return 1;
+  }
+  if (partial_refresh_count >= PARTIALS_PER_FULL_REFRESH) {
+    return 1;
+  }
+  if (FULL_REFRESH_HOURLY && (t->tm_hour != last_full_refresh_hour)) {
+    return 1;
+  }
+  if (FULL_REFRESH_CHANGED_AREA &&
+      ((changed_area + area) >= FULL_REFRESH_CHANGED_AREA)) {
+    return 1;
+  }
+  return 0;
+}
+
+// Updates the tracking variables for the prepared frame once it is shown.
+static void commit_refresh(void) {
+  if (prepared_refresh == PREPARED_FULL) {
+    full_refresh_needed = 0;
+    partial_refresh_count = 0;
+    last_full_refresh_hour = prepared_hour;
+    changed_area = 0;
+  } else {
+    ++partial_refresh_count;
+    changed_area += prepared_area;
+  }
+}
+
+// Folds a value into a widget fingerprint
+static uint16_t fp_add(uint16_t fp, uint32_t v) {
+  for (uint8_t i=0; i<4; ++i, v >>= 8) {
+    fp = _crc16_update(fp, (uint8_t)v);
+  }
+  return fp;
+}
+
+// Fingerprint for widgets that never change (dark mode changes always
+// lead to a full refresh)
+static uint16_t static_fingerprint(const struct Frame* f) {
+  return 0;
+}
+
+static uint16_t time_fingerprint(const struct Frame* f) {
+  uint16_t fp = fp_add(0xFFFF, f->t.tm_hour);
+  fp = fp_add(fp, f->t.tm_min);
+  return fp_add(fp, f->option_bits & OPTION_USE_24H_TIME);
+}
+
+// Renders the time in large numbers.
+static void render_time(const struct Frame* f) {
+  const uint8_t use_24h_time = (f->option_bits & OPTION_USE_24H_TIME);
 
   // Rander the time to the display
   text.font = clock_number_font;
   text.row = 0;
   // 24h time is shifted over because there is no AM/PM to render
   text.column = use_24h_time ? 12 : 0;
-  render_hour(t.tm_hour, use_24h_time);
+  render_hour(f->t.tm_hour, use_24h_time);
   text_char(&text, ':');
-  render_u8_02(t.tm_min);
+  render_u8_02(f->t.tm_min);
+  end_text_line();
+}
 
-  if (!use_24h_time) {
-    // Render AM or PM to complete the 12h time.
-    text.font = labels_font;
-    text.row = AM_PM_ROW;
-    text.column = AM_PM_COLUMN;
-    text_char(&text, t.tm_hour >= 12 ? 'P' : 'A');
-    text_char(&text, 'M');
+static uint16_t am_pm_fingerprint(const struct Frame* f) {
+  return fp_add(
+      fp_add(0xFFFF, f->t.tm_hour >= 12),
+      f->option_bits & OPTION_USE_24H_TIME);
+}
+
+// Renders AM or PM to complete the 12h time.
+static void render_am_pm(const struct Frame* f) {
+  if (f->option_bits & OPTION_USE_24H_TIME) {
+    // The time covers this area instead
+    return;
   }
+  text.font = labels_font;
+  text.row = AM_PM_ROW;
+  text.column = AM_PM_COLUMN;
+  text_char(&text, f->t.tm_hour >= 12 ? 'P' : 'A');
+  text_char(&text, 'M');
+  end_text_line();
+}
 
-  // Separate time and date with a vertical line
+// Separates time and date with a vertical line
+static void render_date_vline(const struct Frame* f) {
   vline(VLINE_DATE_COLUMN, 0, 9);
+}
 
+static uint16_t date_fingerprint(const struct Frame* f) {
+  uint16_t fp = fp_add(0xFFFF, f->t.tm_mday);
+  fp = fp_add(fp, f->t.tm_mon);
+  fp = fp_add(fp, f->t.tm_year);
+  return fp_add(fp, f->option_bits & OPTION_USE_METRIC);
+}
+
+// Render the current date in either YY/MM/DD or DD/MM/YY format.
+static void render_date(const struct Frame* f) {
   text.row = 0;
   text.column = DATE_COLUMN;
-  // Render the current date in either YY/MM/DD or DD/MM/YY format.
-  const bool_t use_english = (eeprom->option_bits & OPTION_USE_METRIC) == 0; 
-  const uint8_t year = t.tm_year % 100; 
-  const uint8_t month = t.tm_mon + 1;
+  const bool_t use_english = (f->option_bits & OPTION_USE_METRIC) == 0; 
+  const uint8_t year = f->t.tm_year % 100; 
+  const uint8_t month = f->t.tm_mon + 1;
   text.font = detail_numbers_font;
 
   render_u8_02(use_english ? month : year);
   text.font = labels_font;
   text_char(&text, '/');
   text.font = detail_numbers_font;
-  render_u8_02(use_english ? t.tm_mday : month);
+  render_u8_02(use_english ? f->t.tm_mday : month);
   text.font = labels_font;
   text_char(&text, '/');
   text.font = detail_numbers_font;
-  render_u8_02(use_english ? year : t.tm_mday);
+  render_u8_02(use_english ? year : f->t.tm_mday);
+  end_text_line();
 }
 
 // Time rendering function that will render either sunrise or sunset time
 static void render_sunrise_sunset_numbers(
+    const struct Frame* f,
+    const uint8_t row,
     const uint8_t hour,
     const uint8_t minute,
-    const uint8_t use_24h_time,
-    const StellarIcon icon,
-    const uint8_t dark_mode) {
+    const StellarIcon icon) {
+  if (!f->dinfo->position_was_set) {
+    erase_tail(DATE_COLUMN, row, row + 2);
+    return;
+  }
+  text.row = row;
   text.column = DATE_COLUMN;
   text.font = detail_numbers_font;
-  render_hour(hour, use_24h_time);
+  render_hour(hour, f->option_bits & OPTION_USE_24H_TIME);
   text.font = labels_font;
   text_char(&text, ':');
   text.font = detail_numbers_font;
   render_u8_02(minute);
+  if (erase_limit && (text.column < SUN_COLUMN)) {
+    // A narrower time can leave part of the old one in the gap
+    fill_area(text.column, row, SUN_COLUMN - 1, row + 2, 0x00);
+  }
   text.column = SUN_COLUMN;
-  text.font = dark_mode ? sun_moon_icons_dark : sun_moon_icons_light;
-  text_char(&text, icon);
+  text.font = sun_moon_icons;
+  text_char(
+      &text,
+      (f->option_bits & OPTION_DARK_MODE) ? icon + DARK_MODE_ICONS : icon);
+  end_text_line();
 }
 
-// Renders both sunrise and sunset times (and associated icons)
-static void render_sunrise_sunset(
-    const time_t time_y2k,
-    const struct EEPromVars* eeprom) {
-  const uint8_t use_24h_time = (eeprom->option_bits & OPTION_USE_24H_TIME);
-  const uint8_t dark_mode = eeprom->option_bits & OPTION_DARK_MODE;
-  text.row = SUNRISE_TIME_ROW;
+static uint16_t sunrise_sunset_fingerprint(
+    const struct Frame* f,
+    const uint8_t hour,
+    const uint8_t minute,
+    const uint8_t icon) {
+  uint16_t fp = fp_add(0xFFFF, f->dinfo->position_was_set);
+  fp = fp_add(fp, hour);
+  fp = fp_add(fp, minute);
+  fp = fp_add(fp, icon);
+  return fp_add(fp, f->option_bits & OPTION_USE_24H_TIME);
+}
+
+static uint16_t sunrise_fingerprint(const struct Frame* f) {
+  return sunrise_sunset_fingerprint(f, sunrise_hour, sunrise_minute, SUN_ICON);
+}
+
+static void render_sunrise(const struct Frame* f) {
   render_sunrise_sunset_numbers(
-      sunrise_hour, sunrise_minute, use_24h_time, SUN_ICON, dark_mode);
-  text.row = SUNSET_TIME_ROW;
+      f, SUNRISE_TIME_ROW, sunrise_hour, sunrise_minute, SUN_ICON);
+}
+
+static uint16_t sunset_fingerprint(const struct Frame* f) {
+  return sunrise_sunset_fingerprint(f, sunset_hour, sunset_minute, moon_icon);
+}
+
+static void render_sunset(const struct Frame* f) {
   render_sunrise_sunset_numbers(
-      sunset_hour, sunset_minute, use_24h_time, moon_icon, dark_mode);
+      f, SUNSET_TIME_ROW, sunset_hour, sunset_minute, moon_icon);
 }
 
-// Renders PTH (Pressure/Time/Humidity) values.
-static void render_pth(
-    uint16_t humidity_cpct,
-    uint32_t pressure_pa,
-    int16_t temp_cc,
-    const struct EEPromVars* eeprom) {
-  const bool_t use_english = (eeprom->option_bits & OPTION_USE_METRIC) == 0; 
+// The PTH (Pressure/Temperature/Humidity) values.  The variables are still
+// called cc and pa in english mode, which might make the code more
+// confusing to read, but anyone looking at the display will not know/care.
+static uint8_t use_english(const struct Frame* f) {
+  return (f->option_bits & OPTION_USE_METRIC) == 0;
+}
 
-  // Get the min/max pressure from the graph's POV.
-  uint32_t min_pressure_pa = pressure_graph_min_pa();
-  uint32_t max_pressure_pa = pressure_graph_max_pa();
+static uint32_t convert_pa(const struct Frame* f, uint32_t pa) {
+  // convert pa to inches.
+  return use_english(f) ? (pa * 1000) / 33864 : pa;
+}
 
-  // pressure_pa is updated every minute while the graph is updated every 10
-  // minutes.  Thus is possible for pressure_pa to wander outside of the
-  // graph's min/max
-  if (pressure_pa < min_pressure_pa) {
-    min_pressure_pa = pressure_pa;
-  } else if (pressure_pa > max_pressure_pa) {
-    max_pressure_pa = pressure_pa;
-  }
+static int16_t convert_cc(const struct Frame* f, int16_t cc) {
+  // convert to farenheit
+  return use_english(f) ? (uint16_t)(((uint32_t)cc) * 9 / 5 + 3200) : cc;
+}
 
-  // Assert there is at least 40 PA before showing the graph, otherwise
-  // the graph just looks like a bunch of noise due to over-magnification.
-  uint8_t show_pressure_graph = (max_pressure_pa - min_pressure_pa) >= 40;
+// Fingerprints below use value / 10 since that is the most precision
+// render_i32x100() will show.  Slight sensor noise then does not cause
+// a redraw.
 
-  if (use_english) {
-    // convert pa to inches.  The variables are still called cc and pa, which
-    // might make the code more confusing to read, but anyone looking at the
-    // display will not know/care.
-    temp_cc = (uint16_t)(((uint32_t)temp_cc) * 9 / 5 + 3200);
-    min_pressure_pa = (min_pressure_pa * 1000) / 33864;
-    max_pressure_pa = (max_pressure_pa * 1000) / 33864;
-    pressure_pa = (pressure_pa * 1000) / 33864;
-  }
+static uint16_t temperature_fingerprint(const struct Frame* f) {
+  return fp_add(
+      fp_add(0xFFFF, convert_cc(f, f->dinfo->temp_cc) / 10),
+      use_english(f));
+}
 
-  // Render the temperature
+static void render_temperature(const struct Frame* f) {
+  const int16_t temp_cc = convert_cc(f, f->dinfo->temp_cc);
   text.row = TEMPERATURE_ROW;
   text.column = TEMPERATURE_COLUMN;
   render_i32x100(
       temp_cc,
-      use_english ? "F" : "C",
+      use_english(f) ? "F" : "C",
       4,
       detail_numbers_font,
       labels_font);
+}
 
-  // render the humidity
+static uint16_t humidity_fingerprint(const struct Frame* f) {
+  return fp_add(0xFFFF, f->dinfo->humidity_cpct / 10);
+}
+
+static void render_humidity(const struct Frame* f) {
   text.row = HUMIDITY_ROW;
   text.column = TEMPERATURE_COLUMN;
   render_i32x100(
-      humidity_cpct,
+      f->dinfo->humidity_cpct,
       "%rH",
       2,
       detail_numbers_font,
       labels_font);
+}
 
-  // put a vertical line between temperature/humidity and the pressure graph
+// put a vertical line between temperature/humidity and the pressure graph
+static void render_temperature_vline(const struct Frame* f) {
   vline(VLINE_TEMPERATURE_COLUMN, 10, 15);
+}
+
+static uint16_t pressure_fingerprint(const struct Frame* f) {
+  uint16_t fp = fp_add(0xFFFF, convert_pa(f, f->dinfo->pressure_pa) / 10);
+  fp = fp_add(fp, convert_pa(f, f->min_pressure_pa) / 10);
+  fp = fp_add(fp, convert_pa(f, f->max_pressure_pa) / 10);
+  return fp_add(fp, use_english(f));
+}
 
-  // render minimum, maximum and current pressure values
+// render minimum, maximum and current pressure values
+static void render_pressure(const struct Frame* f) {
   text.row = PRESSURE_ROW;
   text.column = PRESSURE_COLUMN;
   render_i32x100(
-      pressure_pa,
-      use_english ? " in" : " hPa",
+      convert_pa(f, f->dinfo->pressure_pa),
+      use_english(f) ? " in" : " hPa",
       4,
       pressure_font,
       pressure_font);
@@ -409,7 +673,7 @@ static void render_pth(
   text.row = MAX_PRESSURE_ROW;
   text.column = PRESSURE_COLUMN;
   render_i32x100(
-      max_pressure_pa,
+      convert_pa(f, f->max_pressure_pa),
       " max",
       4,
       pressure_font,
@@ -418,26 +682,60 @@ static void render_pth(
   text.row = MIN_PRESSURE_ROW;
   text.column = PRESSURE_COLUMN;
   render_i32x100(
-      min_pressure_pa,
+      convert_pa(f, f->min_pressure_pa),
       " min",
       4,
       pressure_font,
       pressure_font);
+}
+
+// Assert there is at least 40 PA before showing the graph, otherwise
+// the graph just looks like a bunch of noise due to over-magnification.
+static uint8_t show_pressure_graph(const struct Frame* f) {
+  return (f->max_pressure_pa - f->min_pressure_pa) >= 40;
+}
+
+static uint16_t pressure_graph_fingerprint(const struct Frame* f) {
+  return fp_add(
+      fp_add(0xFFFF, show_pressure_graph(f)),
+      pressure_graph_version());
+}
 
-  if (show_pressure_graph) {
+static void render_pressure_graph(const struct Frame* f) {
+  if (show_pressure_graph(f)) {
     pressure_graph_plot();
+    erase_tail(PRESSURE_GRAPH_COLS, PRESSURE_GRAPH_FIRST_ROW, 15);
+  } else {
+    erase_tail(0, PRESSURE_GRAPH_FIRST_ROW, 15);
   }
 }
 
-void render_gps_stats(const time_t time_y2k) {
+static uint8_t gps_stats_visible(void) {
   const struct GPSStats* gps_stats = gps_get_stats();
   if ((gps_stats->show_policy == GPS_STATS_AUTO) &&
       (gps_stats->last_lock > 0)) {
-    return;
+    return 0;
+  }
+  return gps_stats->show_policy != GPS_STATS_HIDE;
+}
+
+static uint16_t gps_stats_fingerprint(const struct Frame* f) {
+  if (!gps_stats_visible()) {
+    return 0;
   }
-  if (gps_stats->show_policy == GPS_STATS_HIDE) {
+  // Most of the stats are relative to the current time so they change with
+  // every update.
+  return fp_add(
+      fp_add(0xFFFF, f->dinfo->time_y2k),
+      gps_get_stats()->received_messages);
+}
+
+static void render_gps_stats(const struct Frame* f) {
+  if (!gps_stats_visible()) {
     return;
   }
+  const struct GPSStats* gps_stats = gps_get_stats();
+  const time_t time_y2k = f->dinfo->time_y2k;
   text.font = gps_stats_font;
 
   text.row = GPS_STATS_ROW;
@@ -497,14 +795,229 @@ void render_gps_stats(const time_t time_y2k) {
   text_pstr(&text, u32_to_ps(uart_bytes_received)); 
 }
 
+// The display layout.  A widget is only redrawn when its fingerprint
+// changes (or when it overlaps a widget that is being redrawn).  Widgets
+// are drawn in table order so later entries draw on top of earlier ones.
+static const struct Widget widgets[] PROGMEM = {
+  {0, 0, VLINE_DATE_COLUMN - 1, 9, 0, time_fingerprint, render_time},
+  {AM_PM_COLUMN, AM_PM_ROW, VLINE_DATE_COLUMN - 1, 9, 0,
+    am_pm_fingerprint, render_am_pm},
+  {VLINE_DATE_COLUMN, 0, VLINE_DATE_COLUMN, 9, 0,
+    static_fingerprint, render_date_vline},
+  {DATE_COLUMN, 0, DISPLAY_COLUMNS - 1, 2, 0, date_fingerprint, render_date},
+  {DATE_COLUMN, SUNRISE_TIME_ROW, DISPLAY_COLUMNS - 1, SUNRISE_TIME_ROW + 2, 0,
+    sunrise_fingerprint, render_sunrise},
+  {DATE_COLUMN, SUNSET_TIME_ROW, DISPLAY_COLUMNS - 1, SUNSET_TIME_ROW + 2, 0,
+    sunset_fingerprint, render_sunset},
+  {TEMPERATURE_COLUMN, TEMPERATURE_ROW, DISPLAY_COLUMNS - 1, TEMPERATURE_ROW + 2, 0,
+    temperature_fingerprint, render_temperature},
+  {TEMPERATURE_COLUMN, HUMIDITY_ROW, DISPLAY_COLUMNS - 1, HUMIDITY_ROW + 2, 0,
+    humidity_fingerprint, render_humidity},
+  {VLINE_TEMPERATURE_COLUMN, 10, VLINE_TEMPERATURE_COLUMN, 15, 0,
+    static_fingerprint, render_temperature_vline},
+  {PRESSURE_COLUMN, MAX_PRESSURE_ROW, VLINE_TEMPERATURE_COLUMN - 1, 15, 0,
+    pressure_fingerprint, render_pressure},
+  {0, PRESSURE_GRAPH_FIRST_ROW, PRESSURE_GRAPH_COLS - 1, 15, 0,
+    pressure_graph_fingerprint, render_pressure_graph},
+  // GPS stats are drawn over the graph and can run into the pressure values.
+  // The lines vary in length so it's simpler to clear them.
+  {0, GPS_STATS_ROW, VLINE_TEMPERATURE_COLUMN - 1, 15, WIDGET_CLEAR,
+    gps_stats_fingerprint, render_gps_stats},
+};
+
+#define NUM_WIDGETS (sizeof(widgets) / sizeof(widgets[0]))
+static uint16_t widget_fingerprints[NUM_WIDGETS];
+// How far each widget extended the last time it was drawn.  See erase_tail()
+static column_t widget_extents[NUM_WIDGETS];
+
+static void load_widget(uint8_t idx, struct Widget* w) {
+  memcpy_P(w, &widgets[idx], sizeof(struct Widget));
+}
+
+static uint8_t widgets_overlap(const struct Widget* a, const struct Widget* b) {
+  return (a->left_column <= b->right_column) &&
+         (b->left_column <= a->right_column) &&
+         (a->top_row <= b->bottom_row) &&
+         (b->top_row <= a->bottom_row);
+}
+
+// Returns 1 if redrawing w can change any part of other.  A widget that is
+// not cleared only writes the columns before extent, which is as far as its
+// old content reached (see erase_tail()).
+static uint8_t redraw_reaches(
+    const struct Widget* w,
+    column_t extent,
+    const struct Widget* other) {
+  if (!(w->flags & WIDGET_CLEAR) && (extent <= other->left_column)) {
+    return 0;
+  }
+  return widgets_overlap(w, other);
+}
+
+// Updates widget_fingerprints and returns a bitmask of widgets that need
+// to be redrawn.
+static uint16_t find_dirty_widgets(const struct Frame* f) {
+  struct Widget w;
+  struct Widget other;
+  uint16_t dirty = 0;
+  for (uint8_t i=0; i<NUM_WIDGETS; ++i) {
+    load_widget(i, &w);
+    const uint16_t fp = w.fingerprint(f);
+    if (fp != widget_fingerprints[i]) {
+      widget_fingerprints[i] = fp;
+      dirty |= (1 << i);
+    }
+  }
+
+  // Redrawing a dirty widget can erase part of any widget that it reaches,
+  // so those need to be redrawn too.
+  uint16_t last_dirty = 0;
+  while (dirty != last_dirty) {
+    last_dirty = dirty;
+    for (uint8_t i=0; i<NUM_WIDGETS; ++i) {
+      if (!(dirty & (1 << i))) {
+        continue;
+      }
+      load_widget(i, &w);
+      for (uint8_t j=0; j<NUM_WIDGETS; ++j) {
+        if (dirty & (1 << j)) {
+          continue;
+        }
+        load_widget(j, &other);
+        if (redraw_reaches(&w, widget_extents[i], &other)) {
+          dirty |= (1 << j);
+        }
+      }
+    }
+  }
+  return dirty;
+}
+
+// Returns 1 if a is entirely inside of b
+static uint8_t widget_inside(const struct Widget* a, const struct Widget* b) {
+  return (a->left_column >= b->left_column) &&
+         (a->right_column <= b->right_column) &&
+         (a->top_row >= b->top_row) &&
+         (a->bottom_row <= b->bottom_row);
+}
+
+// Returns the number of memory cells covered by the dirty widgets.  A widget
+// inside of another dirty widget (AM/PM inside the time) adds nothing.
+static uint16_t dirty_area(uint16_t dirty) {
+  struct Widget w;
+  struct Widget other;
+  uint16_t area = 0;
+  for (uint8_t i=0; i<NUM_WIDGETS; ++i) {
+    if (!(dirty & (1 << i))) {
+      continue;
+    }
+    load_widget(i, &w);
+    uint8_t inside = 0;
+    for (uint8_t j=0; (j<NUM_WIDGETS) && !inside; ++j) {
+      if ((j != i) && (dirty & (1 << j))) {
+        load_widget(j, &other);
+        inside = widget_inside(&w, &other);
+      }
+    }
+    if (!inside) {
+      area += (w.right_column - w.left_column + 1) *
+              (w.bottom_row - w.top_row + 1);
+    }
+  }
+  return area;
+}
+
+// Returns 1 if a dirty widget that renders before widget idx overlaps it.
+// The area of idx is then no longer known to be clear when idx renders.
+static uint8_t drawn_over(uint8_t idx, const struct Widget* w, uint16_t dirty) {
+  struct Widget other;
+  for (uint8_t i=0; i<idx; ++i) {
+    if (!(dirty & (1 << i))) {
+      continue;
+    }
+    load_widget(i, &other);
+    if (widgets_overlap(w, &other)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Renders the dirty widgets into display RAM.  ALL_WIDGETS starts from a
+// cleared RAM, otherwise the RAM is assumed to hold the previous frame.
+// Only the widget extents are changed so a full frame can be rendered once
+// for each RAM bank.
+static void render_frame(const struct Frame* f, uint16_t dirty) {
+  struct Widget w;
+  struct Widget other;
+  uint16_t cleared = dirty;
+  if (dirty == ALL_WIDGETS) {
+    oledm_clear(&display, 0x00);
+  } else {
+    // All clearing has to happen before rendering since widgets can overlap
+    cleared = 0;
+    for (uint8_t i=0; i<NUM_WIDGETS; ++i) {
+      if (!(dirty & (1 << i))) {
+        continue;
+      }
+      load_widget(i, &w);
+      if (w.flags & WIDGET_CLEAR) {
+        fill_area(w.left_column, w.top_row, w.right_column, w.bottom_row, 0x00);
+        cleared |= (1 << i);
+      }
+    }
+  }
+
+  for (uint8_t i=0; i<NUM_WIDGETS; ++i) {
+    if (dirty & (1 << i)) {
+      load_widget(i, &w);
+      erase_limit = (cleared & (1 << i)) ? 0 : widget_extents[i];
+      // Spaces (such as the padding from render_i32x100()) can be skipped
+      // over when the widget was cleared, unless an earlier widget (e.g.
+      // the graph under the GPS stats) has drawn there since.
+      if ((cleared & (1 << i)) && !drawn_over(i, &w, dirty)) {
+        text.options |= TEXT_OPTION_CLEARED;
+      } else {
+        text.options &= ~TEXT_OPTION_CLEARED;
+      }
+      widget_extent = 0;
+      w.render(f);
+      if (widget_extent > widget_extents[i]) {
+        // The new content is wider than find_dirty_widgets() assumed.  Any
+        // later widget that it now reaches needs to be drawn back on top.
+        for (uint8_t j=i+1; j<NUM_WIDGETS; ++j) {
+          load_widget(j, &other);
+          if (redraw_reaches(&w, widget_extent, &other)) {
+            dirty |= (1 << j);
+          }
+        }
+      }
+      widget_extents[i] = widget_extent;
+    }
+  }
+}
+
 //
 // Interface Implementation
 //
 
+// The SPI module is powered down while main.c idles (SPI_OFF) and needs a
+// re-init before the next byte is sent.
+static void (*idle_until_interrupt)(void);
+static void busy_sleep(void) {
+  idle_until_interrupt();
+  spi_initMasterFreq(SPI_USE_MOSI, SPI_FREQUENCY);
+}
+
 // one-time initialization of epaper display and text object
-void display_init(void) {
+void display_init(
+    void (*wait_for_interrupt)(void),
+    uint8_t (*seconds)(void)) {
   sunrise_hour = 0;
+  full_refresh_needed = 1;
   oledm_basic_init(&display);
+  idle_until_interrupt = wait_for_interrupt;
+  epaper_set_busy_sleep(busy_sleep, seconds);
   text_init(&text, clock_number_font, &display);
   pressure_graph_init(&display);
 }
@@ -541,47 +1054,88 @@ void display_enable_spi(void) {
   RES_DDR |= (1 << RES_PIN);
 }
 
-// When this is called, the epaper display is updated
-void update_display(
+void display_prepare(
     const struct DisplayInfo* dinfo,
-    const struct EEPromVars* eeprom,
-    void (*wait_for_next_second)(void)) {
+    const struct EEPromVars* eeprom) {
   // Get ready
   if (eeprom->option_bits & OPTION_DARK_MODE) {
     display.option_bits |= OLEDM_WHITE_ON_BLACK;
   } else {
     display.option_bits &= ~OLEDM_WHITE_ON_BLACK;
   }
-  oledm_start(&display);
-
-  // Render
-  oledm_clear(&display, 0x00);
-  render_time(
-      dinfo->time_y2k,
-      dinfo->position_was_set,
-      dinfo->pressure_pa,
-      eeprom);
-  if (dinfo->position_was_set) {
-    render_sunrise_sunset(dinfo->time_y2k, eeprom);
-  }
-  render_pth(
-      dinfo->humidity_cpct,
-      dinfo->pressure_pa,
-      dinfo->temp_cc,
-      eeprom);
-
-  render_gps_stats(dinfo->time_y2k);
-
-  // The extra steps are in place to minimize power usage.
-  epaper_swap_buffers_no_wait(&display);
-  // try to save a little power while waiting for the epaper to
-  // do it's update dance.
-  wait_for_next_second();
-  wait_for_next_second();
+
+  if (DISPLAY_TEMPERATURE_WAVEFORMS) {
+    epaper_set_temperature(&display, dinfo->temp_cc / 100);
+  }
+
+  struct Frame f;
+  localtime_r(&(dinfo->time_y2k), &f.t);
+  f.dinfo = dinfo;
+  f.option_bits = eeprom->option_bits;
+  update_state(&f.t, dinfo->time_y2k, dinfo->position_was_set, dinfo->pressure_pa);
+
+  // Get the min/max pressure from the graph's POV.
+  f.min_pressure_pa = pressure_graph_min_pa();
+  f.max_pressure_pa = pressure_graph_max_pa();
+  // pressure_pa is updated every minute while the graph is updated every 10
+  // minutes.  Thus is possible for pressure_pa to wander outside of the
+  // graph's min/max
+  if (dinfo->pressure_pa < f.min_pressure_pa) {
+    f.min_pressure_pa = dinfo->pressure_pa;
+  } else if (dinfo->pressure_pa > f.max_pressure_pa) {
+    f.max_pressure_pa = dinfo->pressure_pa;
+  }
+
+  uint16_t dirty = find_dirty_widgets(&f);
+  prepared_hour = f.t.tm_hour;
+  prepared_area = dirty_area(dirty);
+  if (use_full_refresh(&f.t, prepared_area)) {
+    oledm_start(&display);
+    // A partial refresh compares against the previous frame, which is held
+    // in the color RAM.  Thus a full refresh needs to write both RAMs.
+    display.option_bits |= OLEDM_WRITE_COLOR_RAM;
+    render_frame(&f, ALL_WIDGETS);
+    display.option_bits &= ~OLEDM_WRITE_COLOR_RAM;
+    render_frame(&f, ALL_WIDGETS);
+    prepared_refresh = PREPARED_FULL;
+  } else {
+    // The BW RAM still holds the previous frame so only the widgets that
+    // changed need to be sent, and only the parts of the old content that
+    // the new content does not cover need erasing.
+    epaper_start_partial(&display);
+    render_frame(&f, dirty);
+    prepared_refresh = PREPARED_PARTIAL;
+  }
+}
+
+void display_show(void) {
+  if (prepared_refresh == PREPARED_NONE) {
+    return;
+  }
+  // main.c idles with the SPI module powered down while it waits for the
+  // minute after display_prepare(), see busy_sleep().  This is not
+  // oledm_ifaceInit() because that also resets the controller.
+  spi_initMasterFreq(SPI_USE_MOSI, SPI_FREQUENCY);
+  if (prepared_refresh == PREPARED_FULL) {
+    epaper_swap_buffers_no_wait(&display);
+  } else {
+    epaper_update_partial_no_wait(&display);
+  }
+  commit_refresh();
+  prepared_refresh = PREPARED_NONE;
+  // Sleeps until the refresh is done
   epaper_wait(&display);
 
-  // Deep sleep until next time
-  epaper_sleep_mode(&display, SLEEP_MODE_2);
+  // Deep sleep until next time.  See DISPLAY_SLEEP_MODE
+  epaper_sleep_mode(&display, DISPLAY_SLEEP_MODE);
+}
+
+// When this is called, the epaper display is updated
+void update_display(
+    const struct DisplayInfo* dinfo,
+    const struct EEPromVars* eeprom) {
+  display_prepare(dinfo, eeprom);
+  display_show();
 }
 
 struct OLEDM* display_device(void) {
@@ -591,3 +1145,7 @@ struct OLEDM* display_device(void) {
 void display_recalc_sunrise_sunset(void) {
   sunrise_hour = 0;
 }
+
+void display_force_full_refresh(void) {
+  full_refresh_needed = 1;
+}
@@ -15,15 +15,26 @@ struct DisplayInfo {
   uint8_t position_was_set;  // 0|1
 };
 
-// Called as a part of power up
-void display_init(void);
+// Called as a part of power up.  wait_for_interrupt() and seconds() are
+// used to sleep while the display is busy.  See epaper_set_busy_sleep()
+void display_init(
+    void (*wait_for_interrupt)(void),
+    uint8_t (*seconds)(void));
 
 // Called whenever the display should be updated.  Expected to be around once
 // per minute.
 void update_display(
     const struct DisplayInfo* dinfo,
-    const struct EEPromVars* eeprom,
-    void (*wait_for_next_second)(void));
+    const struct EEPromVars* eeprom);
+
+// update_display() split in two.  display_prepare() sends the frame to the
+// display RAM and leaves the controller awake.  display_show() then only
+// has to start the refresh, which lets the caller time it.  The SPI pins
+// need to stay enabled in between.
+void display_prepare(
+    const struct DisplayInfo* dinfo,
+    const struct EEPromVars* eeprom);
+void display_show(void);
 
 // Used to enable/disable the SPI hardware to avoid
 // leaking current through SPI pins.
@@ -38,5 +49,9 @@ struct OLEDM* display_device(void);
 // in the case where the UTC offset was changed.
 void display_recalc_sunrise_sunset(void);
 
+// Makes the next update a full refresh.  Used when something other than
+// the clock (e.g. the menu) has been drawing on the display.
+void display_force_full_refresh(void);
+
 #endif
 
@@ -5,50 +5,41 @@
 
 const uint8_t gps_stats_font[] PROGMEM = {
     0x56, 0x41, 0x52, 0x31,  // id: VAR1
-    0x28, // num_chars
-    0x01, // height
+    0x1F, // num_chars
+    0x81, // height | VARIABLE_FONT_REVERSED
 
     // Character offsets
-    ' ', 5, 0x00, 0xA0,  // off=160
-    '-', 5, 0x00, 0xA2,  // off=162
-    '.', 5, 0x00, 0xA6,  // off=166
-    '0', 5, 0x00, 0xAB,  // off=171
-    '1', 5, 0x00, 0xB1,  // off=177
-    '2', 5, 0x00, 0xB7,  // off=183
-    '3', 5, 0x00, 0xBD,  // off=189
-    '4', 5, 0x00, 0xC3,  // off=195
-    '5', 5, 0x00, 0xC9,  // off=201
-    '6', 5, 0x00, 0xD0,  // off=208
-    '7', 5, 0x00, 0xD7,  // off=215
-    '8', 5, 0x00, 0xDD,  // off=221
-    '9', 5, 0x00, 0xE4,  // off=228
-    ':', 5, 0x00, 0xEB,  // off=235
-    'A', 6, 0x00, 0xF0,  // off=240
-    'B', 6, 0x00, 0xF7,  // off=247
-    'C', 6, 0x00, 0xFF,  // off=255
-    'D', 5, 0x01, 0x07,  // off=263
-    'E', 5, 0x01, 0x0E,  // off=270
-    'F', 5, 0x01, 0x14,  // off=276
-    'G', 5, 0x01, 0x1A,  // off=282
-    'H', 5, 0x01, 0x20,  // off=288
-    'I', 5, 0x01, 0x27,  // off=295
-    'J', 5, 0x01, 0x2D,  // off=301
-    'K', 6, 0x01, 0x33,  // off=307
-    'L', 5, 0x01, 0x3A,  // off=314
-    'M', 5, 0x01, 0x40,  // off=320
-    'N', 5, 0x01, 0x46,  // off=326
-    'O', 5, 0x01, 0x4C,  // off=332
-    'P', 5, 0x01, 0x53,  // off=339
-    'Q', 5, 0x01, 0x5A,  // off=346
-    'R', 6, 0x01, 0x61,  // off=353
-    'S', 5, 0x01, 0x68,  // off=360
-    'T', 6, 0x01, 0x6F,  // off=367
-    'U', 5, 0x01, 0x77,  // off=375
-    'V', 6, 0x01, 0x7E,  // off=382
-    'W', 6, 0x01, 0x85,  // off=389
-    'X', 6, 0x01, 0x8C,  // off=396
-    'Y', 6, 0x01, 0x93,  // off=403
-    'Z', 6, 0x01, 0x9A,  // off=410
+    ' ', 5, 0x00, 0x7C,  // off=124
+    '.', 5, 0x00, 0x7E,  // off=126
+    '0', 5, 0x00, 0x83,  // off=131
+    '1', 5, 0x00, 0x89,  // off=137
+    '2', 5, 0x00, 0x8F,  // off=143
+    '3', 5, 0x00, 0x95,  // off=149
+    '4', 5, 0x00, 0x9B,  // off=155
+    '5', 5, 0x00, 0xA1,  // off=161
+    '6', 5, 0x00, 0xA8,  // off=168
+    '7', 5, 0x00, 0xAF,  // off=175
+    '8', 5, 0x00, 0xB5,  // off=181
+    '9', 5, 0x00, 0xBC,  // off=188
+    ':', 5, 0x00, 0xC3,  // off=195
+    'A', 6, 0x00, 0xC8,  // off=200
+    'C', 6, 0x00, 0xCF,  // off=207
+    'E', 5, 0x00, 0xD7,  // off=215
+    'F', 5, 0x00, 0xDD,  // off=221
+    'G', 5, 0x00, 0xE3,  // off=227
+    'I', 5, 0x00, 0xE9,  // off=233
+    'K', 6, 0x00, 0xEF,  // off=239
+    'L', 5, 0x00, 0xF6,  // off=246
+    'M', 5, 0x00, 0xFC,  // off=252
+    'N', 5, 0x01, 0x02,  // off=258
+    'O', 5, 0x01, 0x08,  // off=264
+    'P', 5, 0x01, 0x0F,  // off=271
+    'R', 6, 0x01, 0x16,  // off=278
+    'S', 5, 0x01, 0x1D,  // off=285
+    'T', 6, 0x01, 0x24,  // off=292
+    'U', 5, 0x01, 0x2C,  // off=300
+    'V', 6, 0x01, 0x33,  // off=307
+    'X', 6, 0x01, 0x3A,  // off=314
     // Character data
     // Character 32 (0x20) ( )
     // -----
@@ -60,16 +51,6 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -----
     // -----
     0x05, 0x00,
-    // Character 45 (0x2D) (-)
-    // -----
-    // -----
-    // -----
-    // -----
-    // -----
-    // ###--
-    // -----
-    // -----
-    0x03, 0x20, 0x02, 0x00,
     // Character 46 (0x2E) (.)
     // -----
     // -----
@@ -79,7 +60,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -----
     // -----
     // -#---
-    0x82, 0x00, 0x80, 0x03, 0x00,
+    0x82, 0x00, 0x01, 0x03, 0x00,
     // Character 48 (0x30) (0)
     // -----
     // -##--
@@ -89,7 +70,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #--#-
     // #--#-
     // -##--
-    0x85, 0x7C, 0x92, 0x82, 0x7C, 0x00,
+    0x85, 0x3E, 0x49, 0x41, 0x3E, 0x00,
     // Character 49 (0x31) (1)
     // -----
     // --#--
@@ -99,7 +80,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // --#--
     // --#--
     // -###-
-    0x85, 0x00, 0x84, 0xFE, 0x80, 0x00,
+    0x85, 0x00, 0x21, 0x7F, 0x01, 0x00,
     // Character 50 (0x32) (2)
     // -----
     // -##--
@@ -109,7 +90,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -#---
     // #----
     // ####-
-    0x85, 0xC4, 0xA2, 0x92, 0x8C, 0x00,
+    0x85, 0x23, 0x45, 0x49, 0x31, 0x00,
     // Character 51 (0x33) (3)
     // -----
     // -##--
@@ -119,7 +100,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // ---#-
     // #--#-
     // -##--
-    0x85, 0x44, 0x82, 0x92, 0x6C, 0x00,
+    0x85, 0x22, 0x41, 0x49, 0x36, 0x00,
     // Character 52 (0x34) (4)
     // -----
     // ---#-
@@ -129,7 +110,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #####
     // ---#-
     // ---#-
-    0x85, 0x30, 0x28, 0x24, 0xFE, 0x20,
+    0x85, 0x0C, 0x14, 0x24, 0x7F, 0x04,
     // Character 53 (0x35) (5)
     // -----
     // ####-
@@ -139,7 +120,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // ---#-
     // #--#-
     // -##--
-    0x81, 0x4E, 0x02, 0x8A, 0x82, 0x72, 0x00,
+    0x81, 0x72, 0x02, 0x51, 0x82, 0x4E, 0x00,
     // Character 54 (0x36) (6)
     // -----
     // -###-
@@ -149,7 +130,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #--#-
     // #--#-
     // -##--
-    0x81, 0x7C, 0x02, 0x8A, 0x82, 0x72, 0x00,
+    0x81, 0x3E, 0x02, 0x51, 0x82, 0x4E, 0x00,
     // Character 55 (0x37) (7)
     // -----
     // ####-
@@ -159,7 +140,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -#---
     // -#---
     // -#---
-    0x85, 0x02, 0xE2, 0x1A, 0x06, 0x00,
+    0x85, 0x40, 0x47, 0x58, 0x60, 0x00,
     // Character 56 (0x38) (8)
     // -----
     // -##--
@@ -169,7 +150,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #--#-
     // #--#-
     // -##--
-    0x81, 0x6C, 0x02, 0x92, 0x82, 0x6C, 0x00,
+    0x81, 0x36, 0x02, 0x49, 0x82, 0x36, 0x00,
     // Character 57 (0x39) (9)
     // -----
     // -##--
@@ -179,7 +160,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // ---#-
     // ---#-
     // ###--
-    0x81, 0x8C, 0x02, 0x92, 0x82, 0x7C, 0x00,
+    0x81, 0x31, 0x02, 0x49, 0x82, 0x3E, 0x00,
     // Character 58 (0x3A) (:)
     // -----
     // -----
@@ -189,7 +170,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -----
     // -----
     // -#---
-    0x82, 0x00, 0x88, 0x03, 0x00,
+    0x82, 0x00, 0x11, 0x03, 0x00,
     // Character 65 (0x41) (A)
     // ------
     // --#---
@@ -199,17 +180,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -###--
     // #---#-
     // #---#-
-    0x86, 0xC0, 0x3C, 0x22, 0x3C, 0xC0, 0x00,
-    // Character 66 (0x42) (B)
-    // ------
-    // ###---
-    // #--#--
-    // #--#--
-    // ###---
-    // #--#--
-    // #--#--
-    // ###---
-    0x81, 0xFE, 0x02, 0x92, 0x81, 0x6C, 0x02, 0x00,
+    0x86, 0x03, 0x3C, 0x44, 0x3C, 0x03, 0x00,
     // Character 67 (0x43) (C)
     // ------
     // -##---
@@ -219,17 +190,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #-----
     // #--#--
     // -##---
-    0x81, 0x7C, 0x02, 0x82, 0x81, 0x44, 0x02, 0x00,
-    // Character 68 (0x44) (D)
-    // -----
-    // ###--
-    // #--#-
-    // #--#-
-    // #--#-
-    // #--#-
-    // #--#-
-    // ###--
-    0x81, 0xFE, 0x02, 0x82, 0x82, 0x7C, 0x00,
+    0x81, 0x3E, 0x02, 0x41, 0x81, 0x22, 0x02, 0x00,
     // Character 69 (0x45) (E)
     // -----
     // ####-
@@ -239,7 +200,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #----
     // #----
     // ####-
-    0x81, 0xFE, 0x03, 0x92, 0x01, 0x00,
+    0x81, 0x7F, 0x03, 0x49, 0x01, 0x00,
     // Character 70 (0x46) (F)
     // -----
     // ####-
@@ -249,7 +210,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #----
     // #----
     // #----
-    0x81, 0xFE, 0x03, 0x12, 0x01, 0x00,
+    0x81, 0x7F, 0x03, 0x48, 0x01, 0x00,
     // Character 71 (0x47) (G)
     // -----
     // -##--
@@ -259,17 +220,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #--#-
     // #--#-
     // -##--
-    0x85, 0x7C, 0x82, 0x92, 0x74, 0x00,
-    // Character 72 (0x48) (H)
-    // -----
-    // #--#-
-    // #--#-
-    // #--#-
-    // ####-
-    // #--#-
-    // #--#-
-    // #--#-
-    0x81, 0xFE, 0x02, 0x10, 0x82, 0xFE, 0x00,
+    0x85, 0x3E, 0x41, 0x49, 0x2E, 0x00,
     // Character 73 (0x49) (I)
     // -----
     // -###-
@@ -279,17 +230,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // --#--
     // --#--
     // -###-
-    0x85, 0x00, 0x82, 0xFE, 0x82, 0x00,
-    // Character 74 (0x4A) (J)
-    // -----
-    // --##-
-    // ---#-
-    // ---#-
-    // ---#-
-    // ---#-
-    // #--#-
-    // -##--
-    0x85, 0x40, 0x80, 0x82, 0x7E, 0x00,
+    0x85, 0x00, 0x41, 0x7F, 0x41, 0x00,
     // Character 75 (0x4B) (K)
     // ------
     // #--#--
@@ -299,7 +240,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #-#---
     // #-#---
     // #--#--
-    0x84, 0xFE, 0x10, 0x6C, 0x82, 0x02, 0x00,
+    0x84, 0x7F, 0x08, 0x36, 0x41, 0x02, 0x00,
     // Character 76 (0x4C) (L)
     // -----
     // #----
@@ -309,7 +250,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #----
     // #----
     // ####-
-    0x81, 0xFE, 0x03, 0x80, 0x01, 0x00,
+    0x81, 0x7F, 0x03, 0x01, 0x01, 0x00,
     // Character 77 (0x4D) (M)
     // -----
     // #---#
@@ -319,7 +260,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #-#-#
     // #---#
     // #---#
-    0x85, 0xFE, 0x0C, 0x30, 0x0C, 0xFE,
+    0x85, 0x7F, 0x30, 0x0C, 0x30, 0x7F,
     // Character 78 (0x4E) (N)
     // -----
     // #--#-
@@ -329,7 +270,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #-##-
     // #--#-
     // #--#-
-    0x85, 0xFE, 0x0C, 0x30, 0xFE, 0x00,
+    0x85, 0x7F, 0x30, 0x0C, 0x7F, 0x00,
     // Character 79 (0x4F) (O)
     // -----
     // -##--
@@ -339,7 +280,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #--#-
     // #--#-
     // -##--
-    0x81, 0x7C, 0x02, 0x82, 0x82, 0x7C, 0x00,
+    0x81, 0x3E, 0x02, 0x41, 0x82, 0x3E, 0x00,
     // Character 80 (0x50) (P)
     // -----
     // ###--
@@ -349,17 +290,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #----
     // #----
     // #----
-    0x81, 0xFE, 0x02, 0x12, 0x82, 0x0C, 0x00,
-    // Character 81 (0x51) (Q)
-    // -----
-    // -##--
-    // #--#-
-    // #--#-
-    // #--#-
-    // #--#-
-    // #--#-
-    // -##--
-    0x81, 0x7C, 0x02, 0x82, 0x82, 0x7C, 0x00,
+    0x81, 0x7F, 0x02, 0x48, 0x82, 0x30, 0x00,
     // Character 82 (0x52) (R)
     // ------
     // ###---
@@ -369,7 +300,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #-#---
     // #--#--
     // #--#--
-    0x84, 0xFE, 0x12, 0x32, 0xCC, 0x02, 0x00,
+    0x84, 0x7F, 0x48, 0x4C, 0x33, 0x02, 0x00,
     // Character 83 (0x53) (S)
     // -----
     // -##--
@@ -379,7 +310,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // ---#-
     // #--#-
     // -##--
-    0x81, 0x4C, 0x02, 0x92, 0x82, 0x64, 0x00,
+    0x81, 0x32, 0x02, 0x49, 0x82, 0x26, 0x00,
     // Character 84 (0x54) (T)
     // ------
     // #####-
@@ -389,7 +320,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // --#---
     // --#---
     // --#---
-    0x02, 0x02, 0x81, 0xFE, 0x02, 0x02, 0x01, 0x00,
+    0x02, 0x40, 0x81, 0x7F, 0x02, 0x40, 0x01, 0x00,
     // Character 85 (0x55) (U)
     // -----
     // #--#-
@@ -399,7 +330,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // #--#-
     // #--#-
     // -##--
-    0x81, 0x7E, 0x02, 0x80, 0x82, 0x7E, 0x00,
+    0x81, 0x7E, 0x02, 0x01, 0x82, 0x7E, 0x00,
     // Character 86 (0x56) (V)
     // ------
     // #---#-
@@ -409,17 +340,7 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -#-#--
     // -#-#--
     // --#---
-    0x86, 0x06, 0x78, 0x80, 0x78, 0x06, 0x00,
-    // Character 87 (0x57) (W)
-    // ------
-    // #---#-
-    // #---#-
-    // #-#-#-
-    // #-#-#-
-    // -#-#--
-    // -#-#--
-    // -#-#--
-    0x86, 0x1E, 0xE0, 0x18, 0xE0, 0x1E, 0x00,
+    0x86, 0x60, 0x1E, 0x01, 0x1E, 0x60, 0x00,
     // Character 88 (0x58) (X)
     // ------
     // #---#-
@@ -429,25 +350,5 @@ const uint8_t gps_stats_font[] PROGMEM = {
     // -#-#--
     // -#-#--
     // #---#-
-    0x86, 0x82, 0x6C, 0x10, 0x6C, 0x82, 0x00,
-    // Character 89 (0x59) (Y)
-    // ------
-    // #---#-
-    // -#-#--
-    // -#-#--
-    // --#---
-    // --#---
-    // --#---
-    // --#---
-    0x86, 0x02, 0x0C, 0xF0, 0x0C, 0x02, 0x00,
-    // Character 90 (0x5A) (Z)
-    // ------
-    // ####--
-    // ---#--
-    // --#---
-    // -#----
-    // -#----
-    // #-----
-    // ####--
-    0x84, 0xC2, 0xB2, 0x8A, 0x86, 0x02, 0x00,
+    0x86, 0x41, 0x36, 0x08, 0x36, 0x41, 0x00,
 };
@@ -5,27 +5,21 @@
 
 const uint8_t labels_font[] PROGMEM = {
     0x56, 0x41, 0x52, 0x31,  // id: VAR1
-    0x11, // num_chars
-    0x03, // height
+    0x0B, // num_chars
+    0x83, // height | VARIABLE_FONT_REVERSED
 
     // Character offsets
-    ' ', 9, 0x00, 0x44,  // off=68
-    '%', 19, 0x00, 0x46,  // off=70
-    '.', 6, 0x00, 0x7D,  // off=125
-    '/', 8, 0x00, 0x83,  // off=131
-    ':', 6, 0x00, 0x97,  // off=151
-    'A', 14, 0x00, 0xA1,  // off=161
-    'C', 15, 0x00, 0xBE,  // off=190
-    'F', 12, 0x00, 0xE5,  // off=229
-    'H', 12, 0x00, 0xF7,  // off=247
-    'M', 15, 0x01, 0x11,  // off=273
-    'P', 13, 0x01, 0x3D,  // off=317
-    'T', 14, 0x01, 0x56,  // off=342
-    'U', 14, 0x01, 0x68,  // off=360
-    'h', 11, 0x01, 0x88,  // off=392
-    'i', 5, 0x01, 0xA2,  // off=418
-    'n', 11, 0x01, 0xB0,  // off=432
-    'r', 8, 0x01, 0xC6,  // off=454
+    ' ', 9, 0x00, 0x2C,  // off=44
+    '%', 19, 0x00, 0x2E,  // off=46
+    '/', 8, 0x00, 0x65,  // off=101
+    ':', 6, 0x00, 0x79,  // off=121
+    'A', 14, 0x00, 0x83,  // off=131
+    'C', 15, 0x00, 0xA0,  // off=160
+    'F', 12, 0x00, 0xC7,  // off=199
+    'H', 12, 0x00, 0xD9,  // off=217
+    'M', 15, 0x00, 0xF3,  // off=243
+    'P', 13, 0x01, 0x1F,  // off=287
+    'r', 8, 0x01, 0x38,  // off=312
     // Character data
     // Character 32 (0x20) ( )
     // ---------
@@ -78,36 +72,10 @@ const uint8_t labels_font[] PROGMEM = {
     // -------------------
     // -------------------
     // -------------------
-    0x83, 0x00, 0x80, 0xC0, 0x02, 0x40, 0x82, 0xC0, 0x80, 0x05, 0x00, 0x83, 0x80, 0xC0, 0x40, 0x05,
-    0x00, 0x82, 0x1F, 0x30, 0x02, 0x20, 0x89, 0x30, 0x1F, 0x80, 0xE0, 0x30, 0x1C, 0x06, 0xE3, 0x30,
-    0x02, 0x10, 0x82, 0x30, 0xE0, 0x05, 0x00, 0x84, 0x08, 0x0C, 0x07, 0x01, 0x04, 0x00, 0x82, 0x07,
-    0x0C, 0x02, 0x08, 0x83, 0x0C, 0x07, 0x00,
-    // Character 46 (0x2E) (.)
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // ------
-    // --##--
-    // --##--
-    // ------
-    // ------
-    // ------
-    // ------
-    0x0E, 0x00, 0x02, 0x0C, 0x02, 0x00,
+    0x83, 0x00, 0x01, 0x03, 0x02, 0x02, 0x82, 0x03, 0x01, 0x05, 0x00, 0x83, 0x01, 0x03, 0x02, 0x05,
+    0x00, 0x82, 0xF8, 0x0C, 0x02, 0x04, 0x89, 0x0C, 0xF8, 0x01, 0x07, 0x0C, 0x38, 0x60, 0xC7, 0x0C,
+    0x02, 0x08, 0x82, 0x0C, 0x07, 0x05, 0x00, 0x84, 0x10, 0x30, 0xE0, 0x80, 0x04, 0x00, 0x82, 0xE0,
+    0x30, 0x02, 0x10, 0x83, 0x30, 0xE0, 0x00,
     // Character 47 (0x2F) (/)
     // --------
     // --------
@@ -133,8 +101,8 @@ const uint8_t labels_font[] PROGMEM = {
     // --------
     // --------
     // --------
-    0x05, 0x00, 0x82, 0xE0, 0x60, 0x03, 0x00, 0x84, 0x80, 0xF8, 0x3F, 0x03, 0x03, 0x00, 0x83, 0x0C,
-    0x0F, 0x01, 0x04, 0x00,
+    0x05, 0x00, 0x82, 0x07, 0x06, 0x03, 0x00, 0x84, 0x01, 0x1F, 0xFC, 0xC0, 0x03, 0x00, 0x83, 0x30,
+    0xF0, 0x80, 0x04, 0x00,
     // Character 58 (0x3A) (:)
     // ------
     // ------
@@ -160,7 +128,7 @@ const uint8_t labels_font[] PROGMEM = {
     // ------
     // ------
     // ------
-    0x08, 0x00, 0x02, 0x06, 0x04, 0x00, 0x02, 0x0C, 0x02, 0x00,
+    0x08, 0x00, 0x02, 0x60, 0x04, 0x00, 0x02, 0x30, 0x02, 0x00,
     // Character 65 (0x41) (A)
     // --------------
     // --------------
@@ -186,8 +154,8 @@ const uint8_t labels_font[] PROGMEM = {
     // --------------
     // --------------
     // --------------
-    0x05, 0x00, 0x03, 0xC0, 0x08, 0x00, 0x89, 0xC0, 0x78, 0x5F, 0x43, 0x40, 0x43, 0x5F, 0x78, 0xC0,
-    0x03, 0x00, 0x83, 0x08, 0x0F, 0x07, 0x07, 0x00, 0x84, 0x03, 0x0F, 0x08, 0x00,
+    0x05, 0x00, 0x03, 0x03, 0x08, 0x00, 0x89, 0x03, 0x1E, 0xFA, 0xC2, 0x02, 0xC2, 0xFA, 0x1E, 0x03,
+    0x03, 0x00, 0x83, 0x10, 0xF0, 0xE0, 0x07, 0x00, 0x84, 0xC0, 0xF0, 0x10, 0x00,
     // Character 67 (0x43) (C)
     // ---------------
     // ---------------
@@ -213,9 +181,9 @@ const uint8_t labels_font[] PROGMEM = {
     // ---------------
     // ---------------
     // ---------------
-    0x03, 0x00, 0x02, 0x80, 0x81, 0xC0, 0x04, 0x40, 0x81, 0xC0, 0x02, 0x80, 0x03, 0x00, 0x83, 0xFC,
-    0xFF, 0x03, 0x07, 0x00, 0x81, 0x01, 0x02, 0x03, 0x03, 0x00, 0x84, 0x03, 0x07, 0x06, 0x0C, 0x04,
-    0x08, 0x85, 0x0C, 0x04, 0x07, 0x03, 0x00,
+    0x03, 0x00, 0x02, 0x01, 0x81, 0x03, 0x04, 0x02, 0x81, 0x03, 0x02, 0x01, 0x03, 0x00, 0x83, 0x3F,
+    0xFF, 0xC0, 0x07, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x03, 0x00, 0x84, 0xC0, 0xE0, 0x60, 0x30, 0x04,
+    0x10, 0x85, 0x30, 0x20, 0xE0, 0xC0, 0x00,
     // Character 70 (0x46) (F)
     // ------------
     // ------------
@@ -241,7 +209,7 @@ const uint8_t labels_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x81, 0x00, 0x02, 0xC0, 0x08, 0x40, 0x02, 0x00, 0x02, 0xFF, 0x08, 0x20, 0x02, 0x00, 0x02, 0x0F,
+    0x81, 0x00, 0x02, 0x03, 0x08, 0x02, 0x02, 0x00, 0x02, 0xFF, 0x08, 0x04, 0x02, 0x00, 0x02, 0xF0,
     0x09, 0x00,
     // Character 72 (0x48) (H)
     // ------------
@@ -268,8 +236,8 @@ const uint8_t labels_font[] PROGMEM = {
     // ------------
     // ------------
     // ------------
-    0x81, 0x00, 0x02, 0xC0, 0x06, 0x00, 0x02, 0xC0, 0x02, 0x00, 0x02, 0xFF, 0x06, 0x10, 0x02, 0xFF,
-    0x02, 0x00, 0x02, 0x0F, 0x06, 0x00, 0x02, 0x0F, 0x01, 0x00,
+    0x81, 0x00, 0x02, 0x03, 0x06, 0x00, 0x02, 0x03, 0x02, 0x00, 0x02, 0xFF, 0x06, 0x08, 0x02, 0xFF,
+    0x02, 0x00, 0x02, 0xF0, 0x06, 0x00, 0x02, 0xF0, 0x01, 0x00,
     // Character 77 (0x4D) (M)
     // ---------------
     // ---------------
@@ -295,9 +263,9 @@ const uint8_t labels_font[] PROGMEM = {
     // ---------------
     // ---------------
     // ---------------
-    0x81, 0x00, 0x02, 0xC0, 0x81, 0x80, 0x07, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x02, 0x00, 0x8D, 0xFF,
-    0x00, 0x07, 0x3E, 0xF0, 0xC0, 0x00, 0x80, 0xF0, 0x3C, 0x07, 0x00, 0xFF, 0x02, 0x00, 0x81, 0x0F,
-    0x04, 0x00, 0x84, 0x07, 0x0C, 0x07, 0x01, 0x03, 0x00, 0x82, 0x0F, 0x00,
+    0x81, 0x00, 0x02, 0x03, 0x81, 0x01, 0x07, 0x00, 0x81, 0x01, 0x02, 0x03, 0x02, 0x00, 0x8D, 0xFF,
+    0x00, 0xE0, 0x7C, 0x0F, 0x03, 0x00, 0x01, 0x0F, 0x3C, 0xE0, 0x00, 0xFF, 0x02, 0x00, 0x81, 0xF0,
+    0x04, 0x00, 0x84, 0xE0, 0x30, 0xE0, 0x80, 0x03, 0x00, 0x82, 0xF0, 0x00,
     // Character 80 (0x50) (P)
     // -------------
     // -------------
@@ -323,142 +291,8 @@ const uint8_t labels_font[] PROGMEM = {
     // -------------
     // -------------
     // -------------
-    0x81, 0x00, 0x02, 0xC0, 0x06, 0x40, 0x82, 0xC0, 0x80, 0x03, 0x00, 0x02, 0xFF, 0x06, 0x20, 0x83,
-    0x30, 0x1F, 0x0F, 0x02, 0x00, 0x02, 0x0F, 0x0A, 0x00,
-    // Character 84 (0x54) (T)
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    // -############-
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // ------##------
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    0x81, 0x00, 0x05, 0x40, 0x02, 0xC0, 0x05, 0x40, 0x07, 0x00, 0x02, 0xFF, 0x0C, 0x00, 0x02, 0x0F,
-    0x06, 0x00,
-    // Character 85 (0x55) (U)
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // -##--------##-
-    // --#--------#--
-    // --##------##--
-    // --##------##--
-    // ---##----##---
-    // ----######----
-    // --------------
-    // --------------
-    // --------------
-    // --------------
-    0x81, 0x00, 0x02, 0xC0, 0x08, 0x00, 0x02, 0xC0, 0x02, 0x00, 0x82, 0x7F, 0xFF, 0x08, 0x00, 0x82,
-    0xFF, 0x7F, 0x03, 0x00, 0x83, 0x03, 0x07, 0x0C, 0x04, 0x08, 0x83, 0x0C, 0x07, 0x03, 0x02, 0x00,
-    // Character 104 (0x68) (h)
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -##--------
-    // -##--------
-    // -##--------
-    // -##--------
-    // -##-####---
-    // -###---##--
-    // -###----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    0x81, 0x00, 0x02, 0xE0, 0x09, 0x00, 0x02, 0xFF, 0x81, 0x0C, 0x03, 0x02, 0x83, 0x06, 0xFC, 0xF8,
-    0x02, 0x00, 0x02, 0x0F, 0x05, 0x00, 0x02, 0x0F, 0x01, 0x00,
-    // Character 105 (0x69) (i)
-    // -----
-    // -----
-    // -----
-    // -----
-    // -----
-    // -##--
-    // -##--
-    // -----
-    // -----
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -##--
-    // -----
-    // -----
-    // -----
-    // -----
-    0x81, 0x00, 0x02, 0x60, 0x03, 0x00, 0x02, 0xFE, 0x03, 0x00, 0x02, 0x0F, 0x02, 0x00,
-    // Character 110 (0x6E) (n)
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    // -##-####---
-    // -###---##--
-    // -###----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -##-----##-
-    // -----------
-    // -----------
-    // -----------
-    // -----------
-    0x0C, 0x00, 0x02, 0xFE, 0x81, 0x0C, 0x03, 0x02, 0x83, 0x06, 0xFC, 0xF8, 0x02, 0x00, 0x02, 0x0F,
-    0x05, 0x00, 0x02, 0x0F, 0x01, 0x00,
+    0x81, 0x00, 0x02, 0x03, 0x06, 0x02, 0x82, 0x03, 0x01, 0x03, 0x00, 0x02, 0xFF, 0x06, 0x04, 0x83,
+    0x0C, 0xF8, 0xF0, 0x02, 0x00, 0x02, 0xF0, 0x0A, 0x00,
     // Character 114 (0x72) (r)
     // --------
     // --------
@@ -484,5 +318,5 @@ const uint8_t labels_font[] PROGMEM = {
     // --------
     // --------
     // --------
-    0x09, 0x00, 0x02, 0xFE, 0x81, 0x18, 0x03, 0x06, 0x02, 0x00, 0x02, 0x0F, 0x05, 0x00,
+    0x09, 0x00, 0x02, 0x7F, 0x81, 0x18, 0x03, 0x60, 0x02, 0x00, 0x02, 0xF0, 0x05, 0x00,
 };
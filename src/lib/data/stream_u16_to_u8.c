@@ -1,11 +1,21 @@
 #include "stream_u16_to_u8.h"
 
+static void tracker_init(
+    struct StreamU16ToU8Tracker* t, stream_index_t* index) {
+  t->index = index;
+  t->first = 0;
+  t->count = 0;
+  t->lossy = 0;
+}
+
 void stream_u16_to_u8_init(
     struct StreamU16ToU8* s,
     uint16_t buff_size,
     uint8_t target_max,
     uint16_t* src,
-    uint8_t* target) {
+    uint8_t* target,
+    stream_index_t* min_index,
+    stream_index_t* max_index) {
   s->buff_size = buff_size;
   s->head = 0;
   s->wrapped = 0;
@@ -14,112 +24,233 @@ void stream_u16_to_u8_init(
   s->max = 0x0;
   s->src = src;
   s->target = target;
+  s->scale = 0;
+  s->axis_step = 0;
+  s->axis_min = 0xFFFF;
+  s->axis_max = 0x0;
+  s->rescales = 0;
+  s->spread = 0;
+  s->index_size = buff_size;
+  tracker_init(&s->min_tracker, min_index);
+  tracker_init(&s->max_tracker, max_index);
 }
 
-static void scale_target_points(
-    struct StreamU16ToU8* s, uint16_t start_idx, uint16_t count) {
+// Bits after the binary point in s->scale
+#define SCALE_SHIFT 24
+
+// Sets s->scale for the current axis.  The reciprocal of the range
+// is rounded up, which gives the same result as target_max * value / range
+// for ranges up to 4096 (range^2 <= 2^SCALE_SHIFT).  Larger ranges can be
+// one higher than the division, but never above target_max.  The range of
+// pressure_graph.c is in 10 Pa units so never gets that large.
+static void update_scale(struct StreamU16ToU8* s) {
   // if min-max, we could have a divide by zero.  Just set it to one
   // and the result will be zero in this case.
-  const uint16_t range = s->max > s->min ?  s->max - s->min : 1;
+  const uint16_t range =
+    s->axis_max > s->axis_min ?  s->axis_max - s->axis_min : 1;
+  s->scale =
+    (((uint32_t)s->target_max << SCALE_SHIFT) + range - 1) / range;
+}
 
-  for (uint16_t i=0; i<count; ++i) {
-    // need to take the measurement in the range of min-max and
-    // scale it to target_max
-    s->target[start_idx] = 
-      (uint8_t)(s->target_max *
-          (uint32_t)(s->src[start_idx] - s->min) /
-          range);
-    ++start_idx;
-    if (start_idx == s->buff_size) {
-      start_idx = 0;
+uint8_t stream_u16_to_u8_value(const struct StreamU16ToU8* s, uint16_t idx) {
+  // need to take the measurement in the range of the axis and
+  // scale it to target_max
+  return (uint8_t)(
+      ((uint32_t)(s->src[idx] - s->axis_min) * s->scale) >> SCALE_SHIFT);
+}
+
+// Moves the axis to fit min and max, see axis_step.  Returns 1 if it
+// changed.
+static uint8_t update_axis(struct StreamU16ToU8* s) {
+  const uint16_t step = s->axis_step;
+  if (!step) {
+    if ((s->axis_min == s->min) && (s->axis_max == s->max)) {
+      return 0;
     }
+    s->axis_min = s->min;
+    s->axis_max = s->max;
+    return 1;
   }
-}
 
-static void add_src_point(
-    struct StreamU16ToU8* s, uint16_t value, uint8_t call_scale_target_points) {
-  uint8_t set_all_target_points = 0;
-  if (value < s->min) {
-    s->min = value;
-    set_all_target_points = 1;
+  const uint16_t low = s->min - (s->min % step);
+  uint32_t high = (uint32_t)s->max + step - 1;
+  high -= high % step;
+  if (high <= low) {
+    high = low + step;
   }
-  
-  if (value > s->max) {
-    s->max = value;
-    set_all_target_points = 1;
+  if (high > 0xFFFF) {
+    high = 0xFFFF;
   }
 
-  s->src[s->head] = value;
+  if ((s->min >= s->axis_min) &&
+      (s->max <= s->axis_max) &&
+      (low <= (uint32_t)s->axis_min + step) &&
+      (high + step >= s->axis_max)) {
+    // the data is still in the band
+    return 0;
+  }
+  s->axis_min = low;
+  s->axis_max = (uint16_t)high;
+  return 1;
+}
 
-  if (call_scale_target_points) {
-    if (set_all_target_points) {
-      scale_target_points(s, 0, s->buff_size);
-    } else {
-      scale_target_points(s, s->head, 1);
-    }
+// Scales a value that can be outside of the axis
+static uint8_t scale_clamped(const struct StreamU16ToU8* s, int32_t value) {
+  if (value <= s->axis_min) {
+    return 0;
   }
-  ++s->head;
-  if (s->head == s->buff_size) {
-    s->head = 0;
-    s->wrapped = 1;
+  if (value >= s->axis_max) {
+    return s->target_max;
   }
+  return (uint8_t)(
+      ((uint32_t)(value - s->axis_min) * s->scale) >> SCALE_SHIFT);
 }
 
-static void find_new_min(struct StreamU16ToU8* s) {
-  s->min = 0xFFFF;
-  for (uint8_t i=0; i < s->buff_size; ++i) {
-    if (s->src[i] < s->min) {
-      s->min = s->src[i];
-    }
+void stream_u16_to_u8_range(
+    const struct StreamU16ToU8* s, uint16_t idx, uint8_t* low, uint8_t* high) {
+  const uint8_t spread = s->spread ? s->spread[idx] : 0;
+  if (!spread) {
+    *low = stream_u16_to_u8_value(s, idx);
+    *high = *low;
+    return;
   }
+  const uint16_t point = s->src[idx];
+  *low = scale_clamped(s, (int32_t)point - (spread & 0x0F));
+  *high = scale_clamped(s, (int32_t)point + (spread >> 4));
 }
 
-static void find_new_max(struct StreamU16ToU8* s) {
-  s->max = 0x0;
-  for (uint8_t i=0; i < s->buff_size; ++i) {
-    if (s->src[i] > s->max) {
-      s->max = s->src[i];
+static void scale_target_points(
+    struct StreamU16ToU8* s, uint16_t start_idx, uint16_t count) {
+  if (!s->target) {
+    return;
+  }
+  for (uint16_t i=0; i<count; ++i) {
+    s->target[start_idx] = stream_u16_to_u8_value(s, start_idx);
+    ++start_idx;
+    if (start_idx == s->buff_size) {
+      start_idx = 0;
     }
   }
 }
 
-void stream_u16_to_u8_add_point(struct StreamU16ToU8* s, uint16_t value) {
-  //
-  // lot of cases needed to efficienctly maintain min/max
-  //
+// Returns the position in t->index of the nth entry
+static inline uint16_t tracker_position(
+    const struct StreamU16ToU8* s,
+    const struct StreamU16ToU8Tracker* t,
+    uint16_t n) {
+  const uint16_t position = t->first + n;
+  return position >= s->index_size ? position - s->index_size : position;
+}
+
+// Returns the value at the front of the tracker: the min or max
+static inline uint16_t tracker_front(
+    const struct StreamU16ToU8* s, const struct StreamU16ToU8Tracker* t) {
+  return s->src[t->index[t->first]];
+}
+
+// Adds src[idx], which was just written.  Older points that can never be
+// the min (or max) again are popped off the back first.
+static void tracker_push(
+    struct StreamU16ToU8* s,
+    struct StreamU16ToU8Tracker* t,
+    uint16_t idx,
+    uint8_t is_max) {
+  const uint16_t value = s->src[idx];
+  while (t->count) {
+    const uint16_t back = s->src[t->index[tracker_position(s, t, t->count - 1)]];
+    if (is_max ? (back > value) : (back < value)) {
+      break;
+    }
+    --t->count;
+  }
+  if (!t->count) {
+    // everything was popped so nothing is missing any more
+    t->lossy = 0;
+  } else if (t->count == s->index_size) {
+    // Full.  Replacing the newest entry keeps the front and this point.
+    --t->count;
+    t->lossy = 1;
+  }
+  t->index[tracker_position(s, t, t->count)] = (stream_index_t)idx;
+  ++t->count;
+}
 
-  if (!s->wrapped || (s->min == s->max)) {
-    // No need to check the dropped points
-    add_src_point(s, value, 1);
+// Called before src[idx] is overwritten.  It can only be in the tracker as
+// the front entry since it is the oldest point.  If entries were dropped
+// while the tracker was full, the rest of the window is pushed again.
+static void tracker_drop(
+    struct StreamU16ToU8* s,
+    struct StreamU16ToU8Tracker* t,
+    uint16_t idx,
+    uint8_t is_max) {
+  if (!t->count || (t->index[t->first] != idx)) {
+    return;
+  }
+  if (!t->lossy) {
+    t->first = tracker_position(s, t, 1);
+    --t->count;
     return;
   }
+  tracker_init(t, t->index);
+  for (uint16_t n = 1; n < s->buff_size; ++n) {
+    if (++idx == s->buff_size) {
+      idx = 0;
+    }
+    tracker_push(s, t, idx, is_max);
+  }
+}
 
-  // if the point that is being dropped was a min or a max,
-  // then the whole array needs to scanned to find a new one
-  const uint8_t scan_for_new_min = 
-    (s->min == s->src[s->head]) &&
-    (value > s->min);
+static void add_point(
+    struct StreamU16ToU8* s, uint16_t value, uint8_t spread) {
+  const uint16_t head = s->head;
 
-  const uint8_t scan_for_new_max =
-    (s->max == s->src[s->head]) &&
-    (value < s->max);
+  if (s->wrapped) {
+    // src[head] is the point that falls out of the window
+    tracker_drop(s, &s->min_tracker, head, 0);
+    tracker_drop(s, &s->max_tracker, head, 1);
+  }
 
-  // Note that call_set_pixels should only be set if scan_for_new_min
-  // and scan_for_new_max are false.  Otherwise the CPU might waste
-  // cycles calculating all pixels (because measurement sets a new
-  // min or max) onyl to set them all again due to scan_for_new_min or
-  // scan_for_new_max being set.
-  add_src_point(s, value, !scan_for_new_min && !scan_for_new_max);
+  s->src[head] = value;
+  if (s->spread) {
+    s->spread[head] = spread;
+  }
+  tracker_push(s, &s->min_tracker, head, 0);
+  tracker_push(s, &s->max_tracker, head, 1);
+  s->min = tracker_front(s, &s->min_tracker);
+  s->max = tracker_front(s, &s->max_tracker);
 
-  if (scan_for_new_min) {
-    find_new_min(s);
+  if (update_axis(s)) {
+    // all pixels need to be recalculated if the axis changes
+    ++s->rescales;
+    update_scale(s);
+    scale_target_points(s, 0, s->buff_size);
+  } else {
+    scale_target_points(s, head, 1);
   }
-  if (scan_for_new_max) {
-    find_new_max(s);
+
+  ++s->head;
+  if (s->head == s->buff_size) {
+    s->head = 0;
+    s->wrapped = 1;
   }
+}
 
-  if (scan_for_new_min || scan_for_new_max) {
-    // all pixels need to be recalculated if min or max changes
-    scale_target_points(s, 0, s->buff_size);
+// Returns the offset from a up to b, clamped to 0..15
+static inline uint8_t nibble_offset(uint16_t a, uint16_t b) {
+  if (b <= a) {
+    return 0;
   }
+  return b - a > 15 ? 15 : b - a;
+}
+
+void stream_u16_to_u8_add_point(struct StreamU16ToU8* s, uint16_t value) {
+  add_point(s, value, 0);
+}
+
+void stream_u16_to_u8_add_range(
+    struct StreamU16ToU8* s, uint16_t value, uint16_t low, uint16_t high) {
+  add_point(
+      s,
+      value,
+      (nibble_offset(value, high) << 4) | nibble_offset(low, value));
 }
@@ -3,6 +3,34 @@
 
 #include <inttypes.h>
 
+// The largest buff_size that will be used.  Setting this to 256 or less
+// halves the RAM needed by the min/max trackers.
+#ifndef STREAM_U16_TO_U8_MAX_POINTS
+#define STREAM_U16_TO_U8_MAX_POINTS 65535
+#endif
+
+#if STREAM_U16_TO_U8_MAX_POINTS <= 256
+typedef uint8_t stream_index_t;
+#else
+typedef uint16_t stream_index_t;
+#endif
+
+// Tracks the min (or max) of the window with a monotonic deque.  index
+// holds src indexes, oldest first, whose values only go up (or down for
+// max).  The front is thus the min and each index is pushed and popped at
+// most once, which makes add_point O(1) amortized.
+//
+// index is a ring of index_size entries, starting at first.  When it is
+// full, the newest entry is replaced and lossy is set.  The front is still
+// right but the entries after it may not be, so the window is scanned again
+// when the front drops out of it.
+struct StreamU16ToU8Tracker {
+  stream_index_t* index;
+  uint16_t first;
+  uint16_t count;
+  uint8_t lossy;
+};
+
 // takes a uint16_t data stream and scales it to fit in a u8 range
 // tracks min and max and rescales target data to fit within target_max
 struct StreamU16ToU8 {
@@ -14,18 +42,80 @@ struct StreamU16ToU8 {
   uint16_t min;  // minimum src value in current window
   uint16_t max;  // maximum src value in current window
   uint16_t* src; // source data
-  uint8_t* target; // target data
+  uint8_t* target; // target data, or NULL to scale with stream_u16_to_u8_value()
+  uint32_t scale;  // target_max / (axis_max - axis_min) as 8.24 fixed point
+
+  // Points are scaled from axis_min..axis_max.  When axis_step is zero,
+  // the axis is min..max and every new min or max rescales all points.
+  // Otherwise the axis is min and max rounded out to multiples of
+  // axis_step.  It grows as soon as a point is outside of it but only
+  // shrinks once the data is more than a step inside of it, so small
+  // changes to min and max do not rescale anything.  min and max stay
+  // exact either way.
+  uint16_t axis_step;
+  uint16_t axis_min;
+  uint16_t axis_max;
+
+  // Counts changes to the axis, each of which rescales every point
+  uint16_t rescales;
+
+  // Optional, buff_size bytes.  See stream_u16_to_u8_add_range()
+  uint8_t* spread;
+
+  // Entries in each of min_index and max_index, at least 2.  Defaults to
+  // buff_size, which never needs a rescan.  Smaller saves RAM at the cost
+  // of a rescan of the window whenever a full tracker loses its front.
+  uint16_t index_size;
+
+  struct StreamU16ToU8Tracker min_tracker;
+  struct StreamU16ToU8Tracker max_tracker;
 };
 
+// src and target hold buff_size points.  min_index and max_index are
+// storage for the trackers and need index_size entries each.
+//
+// axis_step, spread and index_size can be set after init.
+//
+// target can be NULL, which saves its RAM and the work of rescaling it
+// whenever the min or max changes.  Points are then scaled when they are
+// needed with stream_u16_to_u8_value().
 void stream_u16_to_u8_init(
     struct StreamU16ToU8* stream,
     uint16_t buff_size,
     uint8_t target_max,
     uint16_t* src,
-    uint8_t* target);
+    uint8_t* target,
+    stream_index_t* min_index,
+    stream_index_t* max_index);
 
 void stream_u16_to_u8_add_point(
     struct StreamU16ToU8* stream,
     uint16_t point);
-#endif
 
+// Like stream_u16_to_u8_add_point() but also keeps the lowest and highest
+// values that point stands for, e.g. the readings between two points of a
+// decimated signal.  low <= point <= high.  They are stored in spread as
+// two 4 bit offsets from point (high - point in the upper nibble, point -
+// low in the lower one), which are clamped to 15.  min, max and the axis
+// only follow the points.
+void stream_u16_to_u8_add_range(
+    struct StreamU16ToU8* stream,
+    uint16_t point,
+    uint16_t low,
+    uint16_t high);
+
+// Returns src[idx] scaled to 0..target_max, the same value that target[idx]
+// holds.
+uint8_t stream_u16_to_u8_value(
+    const struct StreamU16ToU8* stream,
+    uint16_t idx);
+
+// Returns the low and high of idx scaled to 0..target_max, see
+// stream_u16_to_u8_add_range().  They are clamped to the axis.  Both are
+// the same as stream_u16_to_u8_value() when there is no spread.
+void stream_u16_to_u8_range(
+    const struct StreamU16ToU8* stream,
+    uint16_t idx,
+    uint8_t* low,
+    uint8_t* high);
+#endif
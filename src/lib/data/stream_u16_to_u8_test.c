@@ -6,9 +6,11 @@ void test_stream(void) {
   struct StreamU16ToU8 s;
   uint16_t src[4];
   uint8_t target[4];
+  stream_index_t min_index[4];
+  stream_index_t max_index[4];
 
   // initial conditions
-  stream_u16_to_u8_init(&s, 4, 100, src, target);
+  stream_u16_to_u8_init(&s, 4, 100, src, target, min_index, max_index);
   assert_int_equal(4, s.buff_size);
   assert_int_equal(0, s.head);
   assert_int_equal(0, s.wrapped);
@@ -184,8 +186,354 @@ void test_stream(void) {
   assert_int_equal(0, target[3]);
 }
 
+// Checks min, max and every target point against a scan of the window
+static void assert_window(const struct StreamU16ToU8* s, uint16_t count) {
+  uint16_t min = 0xFFFF;
+  uint16_t max = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    if (s->src[i] < min) {
+      min = s->src[i];
+    }
+    if (s->src[i] > max) {
+      max = s->src[i];
+    }
+  }
+  assert_int_equal(min, s->min);
+  assert_int_equal(max, s->max);
+
+  const uint16_t range = max > min ? max - min : 1;
+  for (uint16_t i = 0; i < count; ++i) {
+    assert_int_equal(
+        (uint8_t)(s->target_max * (uint32_t)(s->src[i] - min) / range),
+        s->target[i]);
+  }
+}
+
+#define LONG_WINDOW 600
+
+// Windows over 255 points, which the old min/max scan could not handle.
+// The extremes are near the end of the window.
+void test_long_window(void) {
+  struct StreamU16ToU8 s;
+  static uint16_t src[LONG_WINDOW];
+  static uint8_t target[LONG_WINDOW];
+  static stream_index_t min_index[LONG_WINDOW];
+  static stream_index_t max_index[LONG_WINDOW];
+  stream_u16_to_u8_init(
+      &s, LONG_WINDOW, 48, src, target, min_index, max_index);
+
+  for (uint16_t i = 0; i < LONG_WINDOW * 3; ++i) {
+    // a slow rise with the max at point 400 of each pass
+    const uint16_t n = i % LONG_WINDOW;
+    stream_u16_to_u8_add_point(&s, n == 400 ? 9000 : 1000 + n);
+    assert_window(&s, s.wrapped ? LONG_WINDOW : s.head);
+  }
+  assert_int_equal(1000, s.min);
+  assert_int_equal(9000, s.max);
+}
+
+// A random walk like a pressure trace, with long steady climbs and falls
+// that keep the trackers full
+void test_random(void) {
+  struct StreamU16ToU8 s;
+  uint16_t src[150];
+  uint8_t target[150];
+  stream_index_t min_index[150];
+  stream_index_t max_index[150];
+  stream_u16_to_u8_init(&s, 150, 48, src, target, min_index, max_index);
+
+  uint32_t seed = 1;
+  uint16_t value = 5000;
+  for (uint16_t i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    const uint8_t r = (seed >> 16) & 0xFF;
+    if (i % 1000 < 300) {
+      value += r & 3;
+    } else if (i % 1000 < 600) {
+      value -= r & 3;
+    } else {
+      value += (r % 7) - 3;
+    }
+    stream_u16_to_u8_add_point(&s, value);
+    assert_window(&s, s.wrapped ? 150 : s.head);
+    assert_true(s.min_tracker.count <= 150);
+    assert_true(s.max_tracker.count <= 150);
+  }
+}
+
+// Trackers that are much shorter than the steady climbs and falls, which
+// have to drop entries and scan the window again.
+void test_small_index(void) {
+  struct StreamU16ToU8 s;
+  uint16_t src[150];
+  uint8_t target[150];
+  stream_index_t min_index[4];
+  stream_index_t max_index[4];
+  stream_u16_to_u8_init(&s, 150, 48, src, target, min_index, max_index);
+  s.index_size = 4;
+
+  uint32_t seed = 7;
+  uint16_t value = 5000;
+  uint8_t was_lossy = 0;
+  for (uint16_t i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    const uint8_t r = (seed >> 16) & 0xFF;
+    if (i % 1000 < 300) {
+      value += r & 3;
+    } else if (i % 1000 < 600) {
+      value -= r & 3;
+    } else {
+      value += (r % 7) - 3;
+    }
+    stream_u16_to_u8_add_point(&s, value);
+    assert_window(&s, s.wrapped ? 150 : s.head);
+    assert_true(s.min_tracker.count <= 4);
+    assert_true(s.max_tracker.count <= 4);
+    was_lossy |= s.min_tracker.lossy | s.max_tracker.lossy;
+  }
+  assert_true(was_lossy);
+}
+
+// Without a target, points are scaled by stream_u16_to_u8_value()
+void test_no_target(void) {
+  struct StreamU16ToU8 s;
+  struct StreamU16ToU8 lazy;
+  uint16_t src[20];
+  uint16_t lazy_src[20];
+  uint8_t target[20];
+  stream_index_t min_index[20];
+  stream_index_t max_index[20];
+  stream_index_t lazy_min_index[20];
+  stream_index_t lazy_max_index[20];
+  stream_u16_to_u8_init(&s, 20, 48, src, target, min_index, max_index);
+  stream_u16_to_u8_init(
+      &lazy, 20, 48, lazy_src, 0, lazy_min_index, lazy_max_index);
+
+  for (uint16_t i = 0; i < 100; ++i) {
+    const uint16_t value = 1000 + ((i * 37) % 23) * 5;
+    stream_u16_to_u8_add_point(&s, value);
+    stream_u16_to_u8_add_point(&lazy, value);
+    assert_int_equal(s.min, lazy.min);
+    assert_int_equal(s.max, lazy.max);
+    const uint16_t count = s.wrapped ? 20 : s.head;
+    for (uint16_t j = 0; j < count; ++j) {
+      assert_int_equal(target[j], stream_u16_to_u8_value(&lazy, j));
+    }
+  }
+}
+
+// Scales every value in min..min+range with the min and max held in the
+// window and checks the result against target_max * value / range.  Up to
+// EXACT_RANGE the results must be the same, above that they can be one
+// higher.
+#define EXACT_RANGE 4096
+
+static void check_range(
+    struct StreamU16ToU8* s, uint8_t target_max, uint16_t min, uint16_t range) {
+  const uint16_t max = min + range;
+  for (uint32_t value = min; value <= max; ++value) {
+    // the min and max are re-added as they leave the window
+    stream_u16_to_u8_add_point(s, min);
+    stream_u16_to_u8_add_point(s, max);
+    stream_u16_to_u8_add_point(s, (uint16_t)value);
+    const uint8_t expected =
+      (uint8_t)(target_max * (value - min) / (range ? range : 1));
+    const uint8_t actual = s->target[2];
+    if (range <= EXACT_RANGE) {
+      assert_int_equal(expected, actual);
+    } else {
+      assert_true((actual == expected) || (actual == expected + 1));
+      assert_true(actual <= target_max);
+    }
+  }
+}
+
+void test_scale(void) {
+  struct StreamU16ToU8 s;
+  uint16_t src[3];
+  uint8_t target[3];
+  stream_index_t min_index[3];
+  stream_index_t max_index[3];
+
+  static const uint8_t target_maxes[] = {48, 100, 255};
+  for (uint8_t i = 0; i < sizeof(target_maxes); ++i) {
+    stream_u16_to_u8_init(
+        &s, 3, target_maxes[i], src, target, min_index, max_index);
+    // every small range, where most of the points are
+    for (uint32_t range = 0; range < 512; ++range) {
+      check_range(&s, target_maxes[i], (range * 7) % (0x10000 - range), range);
+    }
+    for (uint32_t range = 512; range < EXACT_RANGE; range += 61) {
+      check_range(&s, target_maxes[i], (range * 7) % (0x10000 - range), range);
+    }
+    check_range(&s, target_maxes[i], 0xFFFF - EXACT_RANGE, EXACT_RANGE);
+    for (uint32_t range = EXACT_RANGE + 1; range <= 0xFFFF; range += 4093) {
+      check_range(&s, target_maxes[i], 0xFFFF - range, range);
+    }
+    check_range(&s, target_maxes[i], 0, 0xFFFF);
+  }
+}
+
+// Two days of pressure at one point per 10 minutes: a slow fall of about
+// 3 hPa a day with a little noise, in the 10 Pa units of pressure_graph.c.
+// Returns the rescales during the second day.
+#define DAY_POINTS 144
+
+static uint16_t rescales_per_day(uint16_t axis_step) {
+  struct StreamU16ToU8 s;
+  uint16_t src[150];
+  stream_index_t min_index[150];
+  stream_index_t max_index[150];
+  stream_u16_to_u8_init(&s, 150, 48, src, 0, min_index, max_index);
+  s.axis_step = axis_step;
+
+  uint32_t seed = 7;
+  for (uint16_t i = 0; i < DAY_POINTS * 2; ++i) {
+    seed = seed * 1103515245 + 12345;
+    const uint16_t value = 5130 - i / 5 + ((seed >> 16) % 3);
+    if (i == DAY_POINTS) {
+      // only count the second day, when the window is full
+      s.rescales = 0;
+    }
+    stream_u16_to_u8_add_point(&s, value);
+
+    assert_true(s.axis_min <= s.min);
+    assert_true(s.axis_max >= s.max);
+    if (axis_step) {
+      assert_int_equal(0, s.axis_min % axis_step);
+      assert_int_equal(0, s.axis_max % axis_step);
+    }
+    const uint16_t count = s.wrapped ? 150 : s.head;
+    uint16_t min = 0xFFFF;
+    uint16_t max = 0;
+    for (uint16_t j = 0; j < count; ++j) {
+      // min and max stay exact for the labels
+      if (src[j] < min) {
+        min = src[j];
+      }
+      if (src[j] > max) {
+        max = src[j];
+      }
+      assert_true(stream_u16_to_u8_value(&s, j) <= 48);
+    }
+    assert_int_equal(min, s.min);
+    assert_int_equal(max, s.max);
+  }
+  return s.rescales;
+}
+
+void test_axis_step(void) {
+  // without a step every new low rescales the graph
+  const uint16_t exact = rescales_per_day(0);
+  // 1 hPa steps
+  const uint16_t stepped = rescales_per_day(10);
+  assert_int_equal(52, exact);
+  assert_int_equal(4, stepped);
+}
+
+// The axis grows right away but only shrinks once the data is more than a
+// step inside of it
+void test_axis_hysteresis(void) {
+  struct StreamU16ToU8 s;
+  uint16_t src[4];
+  uint8_t target[4];
+  stream_index_t min_index[4];
+  stream_index_t max_index[4];
+  stream_u16_to_u8_init(&s, 4, 100, src, target, min_index, max_index);
+  s.axis_step = 10;
+
+  stream_u16_to_u8_add_point(&s, 503);
+  assert_int_equal(500, s.axis_min);
+  assert_int_equal(510, s.axis_max);
+  assert_int_equal(30, target[0]);
+  assert_int_equal(1, s.rescales);
+
+  stream_u16_to_u8_add_point(&s, 509);
+  assert_int_equal(500, s.axis_min);
+  assert_int_equal(510, s.axis_max);
+  assert_int_equal(90, target[1]);
+  assert_int_equal(1, s.rescales);
+
+  // grows
+  stream_u16_to_u8_add_point(&s, 512);
+  assert_int_equal(500, s.axis_min);
+  assert_int_equal(520, s.axis_max);
+  assert_int_equal(15, target[0]);
+  assert_int_equal(60, target[2]);
+  assert_int_equal(2, s.rescales);
+
+  // 503 leaves the window but the axis stays
+  stream_u16_to_u8_add_point(&s, 515);
+  stream_u16_to_u8_add_point(&s, 515);
+  assert_int_equal(509, s.min);
+  assert_int_equal(500, s.axis_min);
+  assert_int_equal(2, s.rescales);
+
+  // and 509, which leaves the data more than a step inside
+  stream_u16_to_u8_add_point(&s, 515);
+  assert_int_equal(512, s.min);
+  assert_int_equal(500, s.axis_min);
+  assert_int_equal(2, s.rescales);
+  stream_u16_to_u8_add_point(&s, 525);
+  stream_u16_to_u8_add_point(&s, 525);
+  assert_int_equal(515, s.min);
+  assert_int_equal(525, s.max);
+  assert_int_equal(510, s.axis_min);
+  assert_int_equal(530, s.axis_max);
+  assert_int_equal(3, s.rescales);
+}
+
+void test_range(void) {
+  struct StreamU16ToU8 s;
+  uint16_t src[4];
+  uint8_t spread[4];
+  stream_index_t min_index[4];
+  stream_index_t max_index[4];
+  stream_u16_to_u8_init(&s, 4, 100, src, 0, min_index, max_index);
+  s.spread = spread;
+
+  uint8_t low;
+  uint8_t high;
+  stream_u16_to_u8_add_range(&s, 500, 495, 503);
+  assert_int_equal(0x35, spread[0]);
+  stream_u16_to_u8_add_point(&s, 600);
+  assert_int_equal(0x00, spread[1]);
+  // the offsets are clamped to 15
+  stream_u16_to_u8_add_range(&s, 550, 500, 560);
+  assert_int_equal(0xAF, spread[2]);
+  // min and max only follow the points
+  assert_int_equal(500, s.min);
+  assert_int_equal(600, s.max);
+
+  // 495 and 503 are outside of the axis on the low side
+  stream_u16_to_u8_range(&s, 0, &low, &high);
+  assert_int_equal(0, low);
+  assert_int_equal(3, high);
+  // no spread is the same as the point
+  stream_u16_to_u8_range(&s, 1, &low, &high);
+  assert_int_equal(100, low);
+  assert_int_equal(100, high);
+  stream_u16_to_u8_range(&s, 2, &low, &high);
+  assert_int_equal(35, low);
+  assert_int_equal(60, high);
+
+  // the high side is clamped to the axis too
+  stream_u16_to_u8_add_range(&s, 600, 590, 620);
+  stream_u16_to_u8_range(&s, 3, &low, &high);
+  assert_int_equal(90, low);
+  assert_int_equal(100, high);
+}
+
 int main(void) {
     test(test_stream);
+    test(test_long_window);
+    test(test_random);
+    test(test_small_index);
+    test(test_no_target);
+    test(test_axis_step);
+    test(test_axis_hysteresis);
+    test(test_range);
+    test(test_scale);
 
     return 0;
 }
@@ -0,0 +1,254 @@
+// Host benchmark for stream_u16_to_u8.c using synthetic pressure traces.
+// Build and run with "make bench" in this directory.
+//
+// "scan" is the min/max tracking that the stream used before the monotonic
+// deques: when the point that leaves the window was the min or max, the
+// whole window is scanned for a new one.  It is copied here (with a 16 bit
+// loop index) so the two can be compared on the same data.
+//
+// reads: src values read per point to keep min and max, which is what the
+// tracking costs on the AVR.  Rescaling target points is not counted.
+//
+// rescales: full passes over the target data per 1000 points.  Each is
+// buff_size points, so these dominate when they are frequent.  The
+// last columns use the 1 hPa axis_step of pressure_graph.c, the very last
+// also its 16 entry trackers, which scan the window again whenever a full
+// tracker loses its front.
+//
+// Host time includes the rescales and is only useful for comparing rows
+// against each other.
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../stream_u16_to_u8.c"
+
+#define POINTS 20000
+#define WINDOW 150  // same as pressure_graph.c
+#define ITERATIONS 20
+
+// The min/max tracking from before the deques
+struct ScanStream {
+  uint16_t head;
+  uint8_t wrapped;
+  uint16_t min;
+  uint16_t max;
+  uint16_t src[WINDOW];
+  uint8_t target[WINDOW];
+  uint32_t reads;
+  uint32_t rescales;
+};
+
+static void scan_scale(struct ScanStream* s, uint16_t start, uint16_t count) {
+  const uint16_t range = s->max > s->min ? s->max - s->min : 1;
+  for (uint16_t i = 0; i < count; ++i) {
+    s->target[start] = (uint8_t)(48 * (uint32_t)(s->src[start] - s->min) / range);
+    if (++start == WINDOW) {
+      start = 0;
+    }
+  }
+}
+
+static void scan_add_point(struct ScanStream* s, uint16_t value) {
+  uint8_t scan_min = 0;
+  uint8_t scan_max = 0;
+  uint8_t rescale = 0;
+  if (s->wrapped && (s->min != s->max)) {
+    ++s->reads;
+    scan_min = (s->min == s->src[s->head]) && (value > s->min);
+    scan_max = (s->max == s->src[s->head]) && (value < s->max);
+  }
+  if (value < s->min) {
+    s->min = value;
+    rescale = 1;
+  }
+  if (value > s->max) {
+    s->max = value;
+    rescale = 1;
+  }
+  s->src[s->head] = value;
+  if (scan_min || scan_max) {
+    const uint16_t count = s->wrapped ? WINDOW : s->head + 1;
+    if (scan_min) {
+      s->min = 0xFFFF;
+    }
+    if (scan_max) {
+      s->max = 0;
+    }
+    for (uint16_t i = 0; i < count; ++i) {
+      ++s->reads;
+      if (scan_min && (s->src[i] < s->min)) {
+        s->min = s->src[i];
+      }
+      if (scan_max && (s->src[i] > s->max)) {
+        s->max = s->src[i];
+      }
+    }
+    rescale = 1;
+  }
+  if (rescale) {
+    ++s->rescales;
+    scan_scale(s, 0, WINDOW);
+  } else {
+    scan_scale(s, s->head, 1);
+  }
+  if (++s->head == WINDOW) {
+    s->head = 0;
+    s->wrapped = 1;
+  }
+}
+
+static uint16_t trace[POINTS];
+
+// Pressure in the 10 Pa units of pressure_graph.c, one point per 10 minutes
+static void make_trace(const char* name) {
+  uint32_t seed = 1;
+  double walk = 0;
+  for (uint32_t i = 0; i < POINTS; ++i) {
+    seed = seed * 1103515245 + 12345;
+    const double noise = (double)((seed >> 16) & 0xFF) / 256.0 - 0.5;
+    const double hours = i / 6.0;
+    double pa = 101300;
+    if (!strcmp(name, "diurnal")) {
+      // the twice a day atmospheric tide
+      pa += 100 * sin(hours * 2 * M_PI / 12);
+    } else if (!strcmp(name, "fronts")) {
+      // long steady falls and climbs as weather systems pass
+      const double phase = fmod(hours, 72) / 72;
+      pa += 2000 * (phase < 0.5 ? 0.5 - phase * 2 : phase * 2 - 1.5);
+    } else if (!strcmp(name, "random walk")) {
+      walk += noise * 40;
+      pa += walk;
+    } else {
+      // "noisy": sensor noise on a steady day
+      pa += noise * 30;
+    }
+    trace[i] = (uint16_t)((pa - 50000) / 10);
+  }
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Returns the size of the tracker once the point leaving the window is
+// dropped
+static uint16_t kept(
+    const struct StreamU16ToU8* s, const struct StreamU16ToU8Tracker* t) {
+  const uint8_t dropped =
+    s->wrapped && t->count && (t->index[t->first] == s->head);
+  return t->count - dropped;
+}
+
+// Runs the trace through the deque version with the given axis_step and
+// index_size.  Sets *reads, *rescales and *longest (the most entries a
+// tracker held).  Returns ns per point.
+//
+// Reads are counted from the tracker sizes: per tracker, one for each
+// popped entry, one for the entry that stops the pops and one for the
+// front.
+static double bench_deque(
+    uint16_t axis_step,
+    uint16_t index_size,
+    uint32_t* reads,
+    uint32_t* rescales,
+    uint16_t* longest) {
+  static struct StreamU16ToU8 s;
+  static uint16_t src[WINDOW];
+  static uint8_t target[WINDOW];
+  static stream_index_t min_index[WINDOW];
+  static stream_index_t max_index[WINDOW];
+  *reads = 0;
+  *rescales = 0;
+  *longest = 0;
+  double ns = 0;
+  for (uint8_t n = 0; n < ITERATIONS; ++n) {
+    stream_u16_to_u8_init(&s, WINDOW, 48, src, target, min_index, max_index);
+    s.axis_step = axis_step;
+    s.index_size = index_size;
+    const double start = now_ns();
+    for (uint32_t i = 0; i < POINTS; ++i) {
+      // pops = kept + 1 - the size after the push
+      const uint16_t kept_min = kept(&s, &s.min_tracker);
+      const uint16_t kept_max = kept(&s, &s.max_tracker);
+      stream_u16_to_u8_add_point(&s, trace[i]);
+      if (n == 0) {
+        *reads += kept_min + 1 - s.min_tracker.count +
+          kept_max + 1 - s.max_tracker.count + 4;
+        if (s.min_tracker.count > *longest) {
+          *longest = s.min_tracker.count;
+        }
+        if (s.max_tracker.count > *longest) {
+          *longest = s.max_tracker.count;
+        }
+      }
+    }
+    ns += now_ns() - start;
+    if (n == 0) {
+      *rescales = s.rescales;
+    }
+  }
+  return ns / ((double)ITERATIONS * POINTS);
+}
+
+static double bench_scan(uint32_t* reads, uint32_t* rescales) {
+  static struct ScanStream s;
+  double ns = 0;
+  for (uint8_t n = 0; n < ITERATIONS; ++n) {
+    memset(&s, 0, sizeof(s));
+    s.min = 0xFFFF;
+    const double start = now_ns();
+    for (uint32_t i = 0; i < POINTS; ++i) {
+      scan_add_point(&s, trace[i]);
+    }
+    ns += now_ns() - start;
+    if (n == 0) {
+      *reads = s.reads;
+      *rescales = s.rescales;
+    }
+  }
+  return ns / ((double)ITERATIONS * POINTS);
+}
+
+int main(void) {
+  static const char* traces[] = {"diurnal", "fronts", "random walk", "noisy"};
+  printf("%d points, window of %d\n\n", POINTS, WINDOW);
+  printf("%-12s  %26s  %32s  %17s  %17s\n",
+      "", "scan", "deque", "deque, 1 hPa axis", "and 16 entries");
+  printf("%-12s  %6s %8s %9s  %6s %8s %7s %7s  %8s %7s  %8s %7s\n",
+      "trace", "reads", "rescales", "time",
+      "reads", "rescales", "longest", "time", "rescales", "time",
+      "rescales", "time");
+  for (uint8_t i = 0; i < sizeof(traces) / sizeof(traces[0]); ++i) {
+    make_trace(traces[i]);
+    uint32_t scan_reads = 0;
+    uint32_t scan_rescales = 0;
+    const double scan_ns = bench_scan(&scan_reads, &scan_rescales);
+    uint32_t reads;
+    uint32_t rescales;
+    uint16_t longest;
+    const double deque_ns =
+      bench_deque(0, WINDOW, &reads, &rescales, &longest);
+    uint32_t axis_reads;
+    uint32_t axis_rescales;
+    uint16_t axis_longest;
+    const double axis_ns =
+      bench_deque(10, WINDOW, &axis_reads, &axis_rescales, &axis_longest);
+    uint32_t small_reads;
+    uint32_t small_rescales;
+    uint16_t small_longest;
+    const double small_ns =
+      bench_deque(10, 16, &small_reads, &small_rescales, &small_longest);
+    printf("%-12s  %6.1f %8.1f %7.0fns  %6.1f %8.1f %7u %5.0fns  %8.1f %5.0fns  %8.1f %5.0fns\n",
+        traces[i],
+        (double)scan_reads / POINTS, scan_rescales * 1000.0 / POINTS, scan_ns,
+        (double)reads / POINTS, rescales * 1000.0 / POINTS, longest, deque_ns,
+        axis_rescales * 1000.0 / POINTS, axis_ns,
+        small_rescales * 1000.0 / POINTS, small_ns);
+  }
+  return 0;
+}
@@ -24,6 +24,8 @@ typedef uint8_t error_t;
 // SSD1306 Codes
 #define SSD1306_BAD_FONT_ID_ERROR 0x20
 #define TEXT_INVALID_RLE_DATA 0x21
+#define OLEDM_BAND_TOO_WIDE_ERROR 0x22
+#define TEXT_BAD_FONT_INDEX_ERROR 0x23
 
 // MS8607 Codes
 #define MS8607_BAD_PT_CHECKSUM 0x30
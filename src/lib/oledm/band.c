@@ -0,0 +1,40 @@
+#include "band.h"
+
+#include <error_codes.h>
+#include <string.h>
+
+static struct Band band;
+
+void band_render(
+    struct OLEDM* display,
+    column_t left_column,
+    uint8_t top_row,
+    column_t right_column,
+    uint8_t bottom_row,
+    band_render_t render) {
+  if (display->error) {
+    return;
+  }
+  const column_t columns = right_column - left_column + 1;
+  if (columns > OLEDM_BAND_COLUMNS) {
+    display->error = OLEDM_BAND_TOO_WIDE_ERROR;
+    return;
+  }
+
+  // The window wraps from the end of one row to the start of the next so
+  // all of the rows can go out in one go.
+  oledm_set_bounds(display, left_column, top_row, right_column, bottom_row);
+  oledm_start_pixels(display);
+
+  band.left_column = left_column;
+  band.columns = columns;
+  for (uint8_t row = top_row; row <= bottom_row; ++row) {
+    band.row = row;
+    band.mode = BAND_OR;
+    memset(band.pixels, 0, columns);
+    render(&band);
+    oledm_write_pixel_buf(display, band.pixels, columns, 0);
+  }
+
+  oledm_stop(display);
+}
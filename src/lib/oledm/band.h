@@ -0,0 +1,102 @@
+#ifndef OLEDM_BAND_H
+#define OLEDM_BAND_H
+
+// Band rendering
+//
+// Normally text, graphs, etc each set their own window on the display and
+// send a small rectangle.  Band rendering instead composes one row (8
+// pixels tall) at a time in a RAM buffer and sends the whole row.  All of
+// the rows go out in a single window so there is no per-glyph addressing,
+// and anything that rasterizes into the band can overlap or XOR with
+// whatever was put there first.
+//
+// The buffer costs OLEDM_BAND_COLUMNS bytes of static RAM (the width of the
+// display by default, 296 on an SSD1680), but only when band.c is linked.
+// Every cell in the area is sent, so this suits full frames better than
+// partial updates that only send a few changed widgets.
+//
+// Example:
+//
+// static struct Text text;
+//
+// static void render(struct Band* band) {
+//   band_fill(band, 100, 100, 0xFF);  // a vline
+//   text.column = 0;
+//   text.row = 2;
+//   text_band_str(&text, band, "Hello");
+// }
+//
+// band_render(&display, 0, 0, 295, 15, render);
+
+#include "oledm.h"
+#include <inttypes.h>
+
+#ifndef OLEDM_BAND_COLUMNS
+#ifdef SSD1680
+#define OLEDM_BAND_COLUMNS 296
+#else
+#define OLEDM_BAND_COLUMNS 128
+#endif
+#endif
+
+// How band_put() combines a byte with what is already in the band
+#define BAND_SET 0
+#define BAND_OR 1
+#define BAND_XOR 2
+
+struct Band {
+  uint8_t row;  // display row being rendered
+  uint8_t mode;  // BAND_*, set to BAND_OR before each render call
+  column_t left_column;  // display column of pixels[0]
+  column_t columns;  // number of columns in use
+  uint8_t pixels[OLEDM_BAND_COLUMNS];
+};
+
+// Called once per row with band->pixels cleared to 0x00.  The callback
+// should only draw into the band, not talk to the display.
+typedef void (*band_render_t)(struct Band* band);
+
+// Renders the given area (inclusive) one row at a time.  Sets
+// display->error to OLEDM_BAND_TOO_WIDE_ERROR if the area has more than
+// OLEDM_BAND_COLUMNS columns.
+void band_render(
+    struct OLEDM* display,
+    column_t left_column,
+    uint8_t top_row,
+    column_t right_column,
+    uint8_t bottom_row,
+    band_render_t render);
+
+// Combines byte with the band at the given display column.  Columns
+// outside of the band are ignored.
+static inline void band_put(struct Band* band, column_t column, uint8_t byte) {
+  if (column < band->left_column) {
+    return;
+  }
+  column -= band->left_column;
+  if (column >= band->columns) {
+    return;
+  }
+  uint8_t* p = band->pixels + column;
+  switch (band->mode) {
+    case BAND_SET:
+      *p = byte;
+      break;
+    case BAND_OR:
+      *p |= byte;
+      break;
+    default:
+      *p ^= byte;
+      break;
+  }
+}
+
+// band_put() for left_column through right_column (inclusive)
+static inline void band_fill(
+    struct Band* band, column_t left_column, column_t right_column, uint8_t byte) {
+  for (; left_column <= right_column; ++left_column) {
+    band_put(band, left_column, byte);
+  }
+}
+
+#endif
@@ -0,0 +1,258 @@
+#include "band.h"
+#include "graph_display.h"
+#include "text.h"
+
+#include <string.h>
+#include <test/unit_test.h>
+
+// Directly include some deps to avoid making the test makefile more complex
+#include "oledm_fake.c"
+#include "text.c"
+#include "graph_display.c"
+
+// same font as text_test.c
+static struct VariableFont font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 3,
+    .height = 2,
+    .data = {
+      // the data table
+      '+', 3, 0x00, 12,  // 12 bytes to the start of the data
+      '-', 3, 0x00, 19,
+      '|', 1, 0x00, 23,
+
+      0x86, 0x01, 0xFF, 0x01, 0x00, 0xFF, 0x00,
+      0x03, 0x01, 0x03, 0x00,
+      0x02, 0xFF
+    },
+};
+
+// font with VARIABLE_FONT_REVERSED
+static struct VariableFont reversed_font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 3,
+    .height = 2 | VARIABLE_FONT_REVERSED,
+    .data = {
+      '+', 3, 0x00, 12,
+      '-', 3, 0x00, 19,
+      '|', 1, 0x00, 23,
+
+      0x86, 0x80, 0xFF, 0x80, 0x00, 0xFF, 0x00,
+      0x03, 0x80, 0x03, 0x00,
+      0x02, 0xFF
+    },
+};
+
+static struct Text text;
+static struct GraphDisplay gd;
+static uint8_t rows_rendered;
+
+static void render_shapes(struct Band* band) {
+  ++rows_rendered;
+  band_fill(band, 11, 12, 0x0F);
+  band->mode = BAND_XOR;
+  band_put(band, 12, 0xFF);
+  // outside of the band
+  band_put(band, 9, 0xFF);
+  band_put(band, 14, 0xFF);
+}
+
+void test_render(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  oledm_log_reset();
+  rows_rendered = 0;
+
+  band_render(&display, 10, 2, 13, 3, render_shapes);
+  assert_int_equal(0, display.error);
+  assert_int_equal(2, rows_rendered);
+
+  assert_u32_array_equal(
+      ((uint32_t[]){
+          OLEDM_SET_BOUNDS, 10, 2, 13, 3,
+          OLEDM_START_PIXELS,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x0F,
+          OLEDM_WRITE_PIXELS, 0xF0,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x0F,
+          OLEDM_WRITE_PIXELS, 0xF0,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_STOP,
+      }),
+      oledm_log,
+      oledm_logidx
+  );
+  // one write per row
+  assert_int_equal(2, oledm_write_calls);
+}
+
+void test_render_too_wide(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  oledm_log_reset();
+  rows_rendered = 0;
+
+  band_render(&display, 0, 0, OLEDM_BAND_COLUMNS, 0, render_shapes);
+  assert_int_equal(OLEDM_BAND_TOO_WIDE_ERROR, display.error);
+  assert_int_equal(0, rows_rendered);
+  assert_int_equal(0, oledm_logidx);
+}
+
+static void render_text(struct Band* band) {
+  text.column = 1;
+  text.row = 0;
+  text_band_str(&text, band, "|-+");
+  // off the right side
+  text.column = 7;
+  text_band_str(&text, band, "+");
+  text.column = 0;
+  text.row = 1;
+  text.options = TEXT_OPTION_INVERTED;
+  text_band_str(&text, band, "|");
+  text.options = 0;
+}
+
+void test_text(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  text_init(&text, &font, &display);
+  oledm_log_reset();
+
+  band_render(&display, 0, 0, 7, 2, render_text);
+  assert_int_equal(0, display.error);
+
+  assert_u32_array_equal(
+      ((uint32_t[]){
+          OLEDM_SET_BOUNDS, 0, 0, 7, 2,
+          OLEDM_START_PIXELS,
+          // row 0: the same bytes that text_str() sends, one glyph at a time
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0xFF,
+          OLEDM_WRITE_PIXELS, 0x01,
+          OLEDM_WRITE_PIXELS, 0x01,
+          OLEDM_WRITE_PIXELS, 0x01,
+          OLEDM_WRITE_PIXELS, 0x01,
+          OLEDM_WRITE_PIXELS, 0xFF,
+          OLEDM_WRITE_PIXELS, 0x01,
+          // row 1: the inverted | is ORed onto the first column
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0xFF,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0xFF,
+          OLEDM_WRITE_PIXELS, 0x00,
+          // row 2: bottom of the inverted |
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_STOP,
+      }),
+      oledm_log,
+      oledm_logidx
+  );
+}
+
+// Bands are in oledm bit order whatever the font uses
+void test_text_reversed(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  text_init(&text, &font, &display);
+  oledm_log_reset();
+  band_render(&display, 0, 0, 7, 2, render_text);
+  uint32_t expected[5 + 1 + 8 * 3 * 2 + 1];
+  assert_int_equal(sizeof(expected) / sizeof(expected[0]), oledm_logidx);
+  memcpy(expected, oledm_log, sizeof(expected));
+
+  text_init(&text, &reversed_font, &display);
+  oledm_log_reset();
+  band_render(&display, 0, 0, 7, 2, render_text);
+  assert_int_equal(0, display.error);
+  assert_u32_array_equal(expected, oledm_log, oledm_logidx);
+}
+
+static void render_graph(struct Band* band) {
+  graph_display_band(&gd, 3, 1, band);
+}
+
+// every 4th column
+static uint8_t ticmarks(column_t column) {
+  return column & 3 ? 0 : 3;
+}
+
+// The band version of the graph matches graph_display_render()
+void test_graph(void) {
+  struct OLEDM display;
+  uint8_t data[20];
+  for (uint8_t i = 0; i < sizeof(data); ++i) {
+    data[i] = (i * 7) % 24;
+  }
+  oledm_basic_init(&display);
+  graph_display_init(&gd, &display, sizeof(data), 3, data);
+  gd.column_offset = 5;
+  gd.ticmark_callback = ticmarks;
+
+  oledm_log_reset();
+  graph_display_render(&gd, 3, 1);
+  assert_int_equal(0, display.error);
+  uint32_t expected[5 + 1 + 20 * 3 * 2 + 1];
+  assert_int_equal(sizeof(expected) / sizeof(expected[0]), oledm_logidx);
+  memcpy(expected, oledm_log, sizeof(expected));
+
+  oledm_log_reset();
+  band_render(&display, 3, 1, 22, 3, render_graph);
+  assert_int_equal(0, display.error);
+  assert_u32_array_equal(expected, oledm_log, oledm_logidx);
+}
+
+static struct GraphRange ranges(column_t column) {
+  const uint8_t value = (column * 7) % 24;
+  struct GraphRange range = {value > 3 ? value - 3 : 0, value + (column & 3)};
+  return range;
+}
+
+// ... and so do the envelope and filled modes
+void test_graph_modes(void) {
+  struct OLEDM display;
+  uint8_t data[20];
+  for (uint8_t i = 0; i < sizeof(data); ++i) {
+    data[i] = (i * 7) % 24;
+  }
+  oledm_basic_init(&display);
+  graph_display_init(&gd, &display, sizeof(data), 3, data);
+  gd.range_callback = ranges;
+
+  for (uint8_t mode = GRAPH_DISPLAY_ENVELOPE; mode <= GRAPH_DISPLAY_FILLED; ++mode) {
+    gd.mode = mode;
+    oledm_log_reset();
+    graph_display_render(&gd, 3, 1);
+    assert_int_equal(0, display.error);
+    uint32_t expected[5 + 1 + 20 * 3 * 2 + 1];
+    assert_int_equal(sizeof(expected) / sizeof(expected[0]), oledm_logidx);
+    memcpy(expected, oledm_log, sizeof(expected));
+
+    oledm_log_reset();
+    band_render(&display, 3, 1, 22, 3, render_graph);
+    assert_int_equal(0, display.error);
+    assert_u32_array_equal(expected, oledm_log, oledm_logidx);
+  }
+}
+
+int main(void) {
+    test(test_render);
+    test(test_render_too_wide);
+    test(test_text);
+    test(test_text_reversed);
+    test(test_graph);
+    test(test_graph_modes);
+
+    return 0;
+}
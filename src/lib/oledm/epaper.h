@@ -19,8 +19,27 @@ typedef enum {
 
 void epaper_sleep_mode(struct OLEDM* display, EpaperSleepMode sleep_mode);
 
+// display->epaper_state bits
+#define EPAPER_RAM_RETAINED  0x01  // RAM still holds the last frame written
+#define EPAPER_AWAKE         0x02  // Out of reset and not in deep sleep
+#define EPAPER_REGISTERS_SET 0x04  // Set up for display->epaper_registers
+#define EPAPER_FULL_LUT      0x08  // Full waveform is loaded
+#define EPAPER_PARTIAL_LUT   0x10  // Partial waveform is loaded
+#define EPAPER_ROWS_SET      0x20  // display->epaper_*_row are current
+#define EPAPER_COLUMNS_SET   0x40  // display->epaper_*_column are current
+#define EPAPER_POINTER_SET   0x80  // RAM pointer is at the window start
+#define EPAPER_WINDOW_SET \
+  (EPAPER_ROWS_SET | EPAPER_COLUMNS_SET | EPAPER_POINTER_SET)
+
+// Returns non-zero if the display RAM still holds the last frame that was
+// written to it.  This is true once the display was put to sleep with
+// SLEEP_MODE_1 and no error has happened since.  In that case, the next
+// frame only needs to send what changed and can skip clearing the RAM.
+uint8_t epaper_ram_is_retained(const struct OLEDM* display);
+
 // Pulse the reset line.  It is unclear whether it's ever a good idea to do this
-// without following up with setup parameters.
+// without following up with setup parameters.  The driver does not know about
+// resets done this way so follow up with oledm_start().
 void epaper_reset(void);
 // use this with the *_no_wait functions to check for unbusy.  This is
 // useful when you want to do a cheaper wait.
@@ -28,6 +47,20 @@ uint8_t epaper_is_busy(void);
 // Only waits a few seconds, then asserts NO_ACK_ERROR
 void epaper_wait(struct OLEDM* display);
 
+// By default, epaper_wait() polls BUSY every millisecond.  Installing a
+// sleep function lets the MCU sleep through a refresh instead.  BUSY gets a
+// pin change interrupt while waiting, so sleep() only needs to return after
+// the next interrupt of any kind.  The application must define an ISR for
+// that pin change vector, even an empty one.  seconds() is used for the
+// timeout and needs an interrupt that wakes the MCU at least once per second.
+// It has to count up once per second no matter what (it may wrap), thus
+// not a clock that GPS or drift correction can set.
+//
+// sleep() is called with interrupts disabled, right after BUSY was checked.
+// It has to enable them with sei() immediately followed by sleep_cpu() (as
+// the lowpower library does) so that BUSY dropping in between is not missed.
+void epaper_set_busy_sleep(void (*sleep)(void), uint8_t (*seconds)(void));
+
 // The SD1680 epaper display is buffered.  Thus everything you write
 // to it is not shown to the user unless oyu do a "full" update
 // using (epaper_swap_buffers) or a partial update as described below.
@@ -39,6 +72,10 @@ void epaper_swap_buffers(struct OLEDM* display, EpaperSleepMode sleep_mode);
 
 // Used to write to the color (e.g. red, yellow) pixels of the display
 void epaper_start_color_pixels(struct OLEDM* display);
+// Like oledm_clear() but for the color RAM, regardless of
+// OLEDM_WRITE_COLOR_RAM.  Both use the controller's auto write commands
+// when byte is 0x00 or 0xFF.
+void epaper_clear_color_ram(struct OLEDM* display, uint8_t byte);
 
 
 // Partial updates.
@@ -49,6 +86,14 @@ void epaper_start_color_pixels(struct OLEDM* display);
 // partial updates.
 void epaper_set_partial_mode(struct OLEDM* display);
 void epaper_set_full_mode(struct OLEDM* display);
+
+// Full updates normally use a waveform (LUT) that is sent by the host and
+// is the same at every temperature.  Once a temperature is set here, full
+// updates use the waveform that the panel has in OTP for that temperature
+// instead, which is shorter when it's warm.  Set EPAPER_NO_TEMPERATURE to go
+// back to the host waveform.  The partial waveform is not affected.
+#define EPAPER_NO_TEMPERATURE -128
+void epaper_set_temperature(struct OLEDM* display, int8_t celsius);
 // This is called instead of epaper_swap_buffers when partial mode is used
 //
 // Because it's bad for the hardware to forget about sleep mode, it's included as
@@ -56,4 +101,12 @@ void epaper_set_full_mode(struct OLEDM* display);
 void epaper_update_partial_no_wait(struct OLEDM* display);
 void epaper_update_partial(struct OLEDM* display, EpaperSleepMode sleep_mode);
 
+// Used in place of oledm_start() to wake a display that was put to sleep
+// with SLEEP_MODE_1.  The RAM (and thus the previous frame, which partial
+// updates compare against) is kept and the partial waveform is loaded
+// instead of the full one.  Only registers that are not already in the
+// needed state are sent and the RAM window is left to the first
+// oledm_set_bounds() call.
+void epaper_start_partial(struct OLEDM* display);
+
 #endif
@@ -1,4 +1,7 @@
 #include "graph_display.h"
+#include "band.h"
+
+#include <avr/pgmspace.h>
 
 void graph_display_init(
     struct GraphDisplay* gd,
@@ -12,6 +15,130 @@ void graph_display_init(
   gd->column_offset = 0;
   gd->ticmark_callback = 0;
   gd->data = data;
+  gd->data_callback = 0;
+  gd->mode = GRAPH_DISPLAY_LINE;
+  gd->range_callback = 0;
+}
+
+// Converts a data value into a y position
+static inline uint8_t value_to_y(uint8_t graph_height, uint8_t value) {
+  return graph_height >= value ? graph_height - value : 0;
+}
+
+// Converts the data value for a column into a y position
+static inline uint8_t pixel_height(
+    const struct GraphDisplay* gd, uint8_t graph_height, column_t data_column) {
+  return value_to_y(
+      graph_height,
+      gd->data_callback ?
+        gd->data_callback(data_column) :
+        gd->data[data_column]);
+}
+
+// Bits n and up, and bits n and down, of a column byte.  Shifts by a
+// variable amount are a loop on the AVR.
+static const uint8_t from_bit_mask[9] PROGMEM = {
+  0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00,
+};
+static const uint8_t to_bit_mask[8] PROGMEM = {
+  0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF,
+};
+
+// The y positions to draw for a column, low to high
+struct Span {
+  uint8_t low;
+  uint8_t high;
+};
+
+// Returns the y positions that the data of a column covers.  This is a
+// single point except in GRAPH_DISPLAY_ENVELOPE mode.
+static inline struct Span column_extent(
+    const struct GraphDisplay* gd, uint8_t graph_height, column_t data_column) {
+  if ((gd->mode == GRAPH_DISPLAY_ENVELOPE) && gd->range_callback) {
+    const struct GraphRange range = gd->range_callback(data_column);
+    const struct Span span = {
+      value_to_y(graph_height, range.high),
+      value_to_y(graph_height, range.low),
+    };
+    return span;
+  }
+  const uint8_t height = pixel_height(gd, graph_height, data_column);
+  const struct Span span = {height, height};
+  return span;
+}
+
+// Returns the y positions to draw for a column, given the extent of the
+// column before it.
+//
+// the objective is to render a vertical line from the previous extent to
+// this one while avoiding a pixel on the previous extent unless it's also
+// in this one.  For a line, the extents are single points.
+static inline struct Span column_span(
+    const struct GraphDisplay* gd,
+    uint8_t graph_height,
+    struct Span previous,
+    struct Span extent) {
+  struct Span span = extent;
+  if (previous.low > extent.high) {
+    span.high = previous.low - 1;
+  } else if (previous.high < extent.low) {
+    span.low = previous.high + 1;
+  }
+  if (gd->mode == GRAPH_DISPLAY_FILLED) {
+    // down to the bottom of the graph
+    span.high = graph_height;
+  }
+  return span;
+}
+
+// Returns the tic mark pixels for the bottom row of a column
+static inline uint8_t ticmark_pixels(
+    const struct GraphDisplay* gd, column_t data_column) {
+  if (!gd->ticmark_callback) {
+    return 0x00;
+  }
+  // draw some pixels on the bottom
+  const uint8_t ticmark_height = gd->ticmark_callback(data_column);
+  return pgm_read_byte(
+      from_bit_mask + (ticmark_height < 8 ? 8 - ticmark_height : 0));
+}
+
+// Returns the pixels of span that fall in row
+static inline uint8_t span_pixels(struct Span span, uint8_t row) {
+  // The bit system goes from N->S
+  //
+  // 1
+  // 0
+  // 0
+  // 0
+  // 0
+  // 0
+  // 0
+  // 0
+  //
+  // Thus pixel_height=0 would represent y=0 and byte=0x01
+  const uint8_t y_start = row << 3;
+  const uint8_t y_end = y_start + 7;
+  if ((y_start > span.high) || (y_end < span.low)) {
+    return 0x00;
+  }
+  const uint8_t from = span.low > y_start ? span.low - y_start : 0;
+  const uint8_t to = span.high < y_end ? span.high - y_start : 7;
+  return pgm_read_byte(from_bit_mask + from) & pgm_read_byte(to_bit_mask + to);
+}
+
+// Returns the pixels for one column of one row of the graph
+static uint8_t column_pixels(
+    const struct GraphDisplay* gd,
+    uint8_t row,
+    column_t data_column,
+    struct Span span) {
+  uint8_t pixels = span_pixels(span, row);
+  // If there is a tickmark callback, we need to call it on the bottom row
+  if (row == (gd->rows - 1)) {
+    pixels |= ticmark_pixels(gd, data_column);
+  }
+  return pixels;
 }
 
 void graph_display_render(
@@ -31,74 +158,139 @@ void graph_display_render(
 
   oledm_start_pixels(gd->display);
 
+  // Most of the graph area is empty, so identical bytes are collected into
+  // a run and written with a single call.  The RAM window wraps from one
+  // row to the next, thus runs can also continue across rows.
+  uint8_t run_pixels = 0x00;
+  uint16_t run_length = 0;
+
   for (uint8_t row = 0; row < rows; ++row) {
     column_t data_column = gd->column_offset;
-    uint8_t previous_height = graph_height >= gd->data[data_column] ?
-      graph_height - gd->data[data_column] :
-      0;
+    struct Span previous = column_extent(gd, graph_height, data_column);
 
     for (uint8_t column = 0; column < columns; ++column) {
-      const uint8_t pixel_height = graph_height >= gd->data[data_column] ?
-        graph_height - gd->data[data_column] :
-        0;
-      uint8_t pixels = 0x00;
-
-      // If there is a tickmark callback, we need to call it on the bottom row
-      if (gd->ticmark_callback && (row == (rows - 1))) {
-        const uint8_t ticmark_height = gd->ticmark_callback(data_column);
-        for (uint8_t ticmark_pixel = 0; ticmark_pixel < ticmark_height; ++ticmark_pixel) {
-          pixels = (pixels >> 1) | 0x80;  // draw some pixels on the bottom
-        }
-      }
-
-      // the objective is to render a vertical line from prevous_height to pixel_height
-      // while avoiding a pixel on previous height unless it's also height
-      uint8_t low_span = pixel_height;
-      uint8_t high_span = pixel_height;
-      if (previous_height > pixel_height) {
-        high_span = previous_height - 1;
-      } else if (previous_height < pixel_height) {
-        low_span = previous_height + 1;
-      }
+      const struct Span extent = column_extent(gd, graph_height, data_column);
+      const uint8_t pixels = column_pixels(
+          gd,
+          row,
+          data_column,
+          column_span(gd, graph_height, previous, extent));
 
-      // now we look for an overlap of row and low-high span
-      uint8_t y_start = row << 3;
-      const uint8_t y_end = y_start + 7;
-      if ((y_start <= high_span) && (y_end >= low_span)) {
-        // there is some overlap
-        // The bit system goes from N->S
-        //
-        // 1
-        // 0
-        // 0
-        // 0
-        // 0
-        // 0
-        // 0
-        // 0
-        //
-        // Thus pixel_height=0 would represent y=0 and byte=0x01
-        uint8_t mask = 0x01;
-        for (uint8_t y = y_start; y <= y_end; ++y, mask <<= 1) {
-          if (y >= low_span) {
-            if (y > high_span) {
-              break;
-            }
-            pixels |= mask;
-          }
+      if (pixels != run_pixels) {
+        if (run_length) {
+          oledm_write_pixel_run(gd->display, run_pixels, run_length);
         }
-      } 
-
-      oledm_write_pixels(gd->display, pixels);
+        run_pixels = pixels;
+        run_length = 0;
+      }
+      ++run_length;
 
       // chain to the next pixel
-      previous_height = pixel_height;
+      previous = extent;
       ++data_column;
       if (data_column == columns) {
         data_column = 0;
       }
     } 
   }
+  if (run_length) {
+    oledm_write_pixel_run(gd->display, run_pixels, run_length);
+  }
 
   oledm_stop(gd->display);
 }
+
+void graph_display_render_columns(
+    struct GraphDisplay* gd,
+    column_t left_column,
+    uint8_t top_row) {
+  struct OLEDM* display = gd->display;
+  const uint8_t rows = gd->rows;
+  const column_t columns = gd->columns;
+  const uint8_t graph_height = ((rows - 1) << 3) + 7;
+
+  oledm_set_bounds(
+      display,
+      left_column,
+      top_row,
+      left_column + columns - 1,
+      top_row + rows - 1);
+
+  display->option_bits |= OLEDM_COLUMN_MAJOR;
+  oledm_start_pixels(display);
+
+  // Runs are collected the same way as graph_display_render().  They are
+  // shorter here since most columns have a line in them.
+  uint8_t run_pixels = 0x00;
+  uint16_t run_length = 0;
+
+  column_t data_column = gd->column_offset;
+  struct Span previous = column_extent(gd, graph_height, data_column);
+
+  for (column_t column = 0; column < columns; ++column) {
+    // Everything about the column is worked out once for all rows
+    const struct Span extent = column_extent(gd, graph_height, data_column);
+    const struct Span span = column_span(gd, graph_height, previous, extent);
+    const uint8_t ticmark = ticmark_pixels(gd, data_column);
+
+    for (uint8_t row = 0; row < rows; ++row) {
+      uint8_t pixels = span_pixels(span, row);
+      if (row == (rows - 1)) {
+        pixels |= ticmark;
+      }
+
+      if (pixels != run_pixels) {
+        if (run_length) {
+          oledm_write_pixel_run(display, run_pixels, run_length);
+        }
+        run_pixels = pixels;
+        run_length = 0;
+      }
+      ++run_length;
+    }
+
+    previous = extent;
+    ++data_column;
+    if (data_column == columns) {
+      data_column = 0;
+    }
+  }
+  if (run_length) {
+    oledm_write_pixel_run(display, run_pixels, run_length);
+  }
+
+  oledm_stop(display);
+  display->option_bits &= ~OLEDM_COLUMN_MAJOR;
+}
+
+void graph_display_band(
+    struct GraphDisplay* gd,
+    column_t left_column,
+    uint8_t top_row,
+    struct Band* band) {
+  if ((band->row < top_row) || (band->row >= (top_row + gd->rows))) {
+    return;
+  }
+  const uint8_t row = band->row - top_row;
+  const column_t columns = gd->columns;
+  const uint8_t graph_height = ((gd->rows - 1) << 3) + 7;
+
+  column_t data_column = gd->column_offset;
+  struct Span previous = column_extent(gd, graph_height, data_column);
+  for (column_t column = 0; column < columns; ++column) {
+    const struct Span extent = column_extent(gd, graph_height, data_column);
+    band_put(
+        band,
+        left_column + column,
+        column_pixels(
+            gd,
+            row,
+            data_column,
+            column_span(gd, graph_height, previous, extent)));
+    previous = extent;
+    ++data_column;
+    if (data_column == columns) {
+      data_column = 0;
+    }
+  }
+}
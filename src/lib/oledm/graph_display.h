@@ -5,12 +5,25 @@
 // e.g. instead of needing a bitmap which needs rows * columns bytes,
 // you can provide just a single column of magnitudes.
 
-// If you need your data scaled, consider using data/stream_u16_to_u8.h or similar
+// If you need your data scaled, consider using data/stream_u16_to_u8.h or similar.
+// stream_u16_to_u8_value() can be called from data_callback to scale the
+// points as they are drawn.
 
 #include "oledm.h"
 
 #include <inttypes.h>
 
+// Values of graph_display.mode
+#define GRAPH_DISPLAY_LINE 0      // a line through the data values
+#define GRAPH_DISPLAY_ENVELOPE 1  // a band from low to high of range_callback
+#define GRAPH_DISPLAY_FILLED 2    // the area under the line is filled
+
+// The lowest and highest data values of a column, see range_callback
+struct GraphRange {
+  uint8_t low;
+  uint8_t high;
+};
+
 struct GraphDisplay {
   // display object to use
   struct OLEDM* display;
@@ -32,6 +45,21 @@ struct GraphDisplay {
   // note that zero for this data == the bottom of the graph which
   // is opposite of the usual convention
   uint8_t* data;
+
+  // optional data callback.  If != NULL, this is called for the value of
+  // each column instead of reading data, which can then be NULL.  This
+  // lets the values be scaled as the graph is drawn instead of being
+  // stored.
+  uint8_t (*data_callback)(column_t data_idx);
+
+  // One of GRAPH_DISPLAY_*.  Defaults to GRAPH_DISPLAY_LINE.
+  uint8_t mode;
+
+  // Used instead of the data in GRAPH_DISPLAY_ENVELOPE mode.  Returns the
+  // range of values that a column covers, e.g. the lowest and highest
+  // readings that were averaged or sampled into it.  The envelope of each
+  // column is joined to the one before it, like the points of a line.
+  struct GraphRange (*range_callback)(column_t data_idx);
 };
 
 void graph_display_init(
@@ -46,4 +74,22 @@ void graph_display_render(
     column_t left_column,
     uint8_t top_row);
 
+// Same as graph_display_render() but the pixels are sent a column at a
+// time, top row to bottom row, using OLEDM_COLUMN_MAJOR.  The value, line
+// span and tic mark of each column are thus worked out once instead of once
+// per row.  Only for displays that support OLEDM_COLUMN_MAJOR (SSD1680).
+void graph_display_render_columns(
+    struct GraphDisplay* gd,
+    column_t left_column,
+    uint8_t top_row);
+
+// Band rendering version of graph_display_render().  See band.h
+// Draws the graph row that falls in band->row, if any.
+struct Band;
+void graph_display_band(
+    struct GraphDisplay* gd,
+    column_t left_column,
+    uint8_t top_row,
+    struct Band* band);
+
 #endif
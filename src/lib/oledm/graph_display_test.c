@@ -1,5 +1,6 @@
 #include "graph_display.h"
 
+#include <string.h>
 #include <test/unit_test.h>
 
 // Directly include some deps to avoid making the test makefile more complex
@@ -21,6 +22,7 @@ void test_init(void) {
   assert_int_equal(3, gd.columns);
   assert_int_equal(0, gd.column_offset);
   assert_int_equal(0, gd.data - data);
+  assert_true(gd.data_callback == 0);
 }
 
 void test_render(void) {
@@ -182,11 +184,110 @@ void test_render_column_offset_tickmarks(void) {
 
 }
 
+// A flat line the size of the pressure graph.  Pixel bytes are the same as
+// before but identical bytes are sent as runs.
+void test_render_write_calls(void) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+
+  uint8_t data[150];
+  memset(data, 16, sizeof(data));
+  oledm_basic_init(&display);
+  graph_display_init(&gd, &display, 150, 4, data);
+  oledm_log_reset();
+
+  graph_display_render(&gd, 0, 0);
+  assert_int_equal(0, display.error);
+  // bounds + start + 600 pixels + stop
+  assert_int_equal(5 + 1 + 600 * 2 + 1, oledm_logidx);
+  assert_int_equal(0x00, oledm_log[6 + 149 * 2 + 1]);
+  assert_int_equal(0x80, oledm_log[6 + 150 * 2 + 1]);
+  assert_int_equal(0x80, oledm_log[6 + 299 * 2 + 1]);
+  assert_int_equal(0x00, oledm_log[6 + 300 * 2 + 1]);
+  // 150 x 0x00, 150 x 0x80, 300 x 0x00
+  assert_int_equal(3, oledm_write_calls);
+}
+
+// Same as test_render_column_offset_tickmarks but sent a column at a time
+void test_render_columns(void) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+
+  uint8_t data[4] = {10, 9, 6, 5};
+  oledm_basic_init(&display);
+  graph_display_init(&gd, &display, 4, 2, data);
+  gd.column_offset = 1;
+  gd.ticmark_callback = every_other;
+  oledm_log_reset();
+
+  graph_display_render_columns(&gd, 45, 1);
+  assert_int_equal(0, display.error);
+  assert_u32_array_equal(
+      ((uint32_t[]){
+          OLEDM_SET_BOUNDS, 45, 1, 48, 2,
+          OLEDM_START_PIXELS,
+
+          OLEDM_WRITE_PIXELS, 0x40,
+          OLEDM_WRITE_PIXELS, 0xC0,
+
+          OLEDM_WRITE_PIXELS, 0x80,
+          OLEDM_WRITE_PIXELS, 0x03,
+
+          OLEDM_WRITE_PIXELS, 0x00,
+          OLEDM_WRITE_PIXELS, 0xC4,
+
+          OLEDM_WRITE_PIXELS, 0xE0,
+          OLEDM_WRITE_PIXELS, 0x03,
+          OLEDM_STOP,
+      }),
+      oledm_log,
+      oledm_logidx
+  );
+  // only set while the graph is sent
+  assert_int_equal(0, display.option_bits & OLEDM_COLUMN_MAJOR);
+}
+
+static const uint8_t callback_data[4] = {10, 9, 6, 5};
+static uint8_t callback_calls;
+
+static uint8_t data_callback(column_t column) {
+  ++callback_calls;
+  return callback_data[column];
+}
+
+// Same as test_render_column_offset with the data from a callback
+void test_render_data_callback(void) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+  uint8_t data[4] = {10, 9, 6, 5};
+  oledm_basic_init(&display);
+  graph_display_init(&gd, &display, 4, 2, data);
+  gd.column_offset = 1;
+  oledm_log_reset();
+  graph_display_render(&gd, 45, 1);
+  uint32_t expected[5 + 1 + 4 * 2 * 2 + 1];
+  assert_int_equal(sizeof(expected) / sizeof(expected[0]), oledm_logidx);
+  memcpy(expected, oledm_log, sizeof(expected));
+
+  graph_display_init(&gd, &display, 4, 2, 0);
+  gd.column_offset = 1;
+  gd.data_callback = data_callback;
+  callback_calls = 0;
+  oledm_log_reset();
+  graph_display_render(&gd, 45, 1);
+  assert_int_equal(0, display.error);
+  assert_u32_array_equal(expected, oledm_log, oledm_logidx);
+  assert_true(callback_calls > 0);
+}
+
 int main(void) {
     test(test_init);
     test(test_render);
     test(test_render_column_offset);
     test(test_render_column_offset_tickmarks);
+    test(test_render_write_calls);
+    test(test_render_data_callback);
+    test(test_render_columns);
 
     return 0;
 }
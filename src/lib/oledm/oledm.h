@@ -106,6 +106,17 @@ struct OLEDM {
 #ifdef OLEDM_COLOR16
   // Put color only fields here.
 #endif
+#ifdef SSD1680
+  // What the driver knows about the controller, so that commands which
+  // would not change anything can be skipped.  See EPAPER_* in epaper.h
+  uint8_t epaper_state;
+  uint8_t epaper_registers;  // option_bits the registers were set up for
+  int8_t epaper_temperature;  // See epaper_set_temperature()
+  column_t epaper_left_column;  // RAM window
+  column_t epaper_right_column;
+  uint8_t epaper_top_row;
+  uint8_t epaper_bottom_row;
+#endif
 #ifdef OLEDM_EMULATE_MONOCHROME
   // If this is set, extra tracking data needs to be added to the
   // structure.
@@ -134,6 +145,7 @@ struct OLEDM {
 #define OLEDM_WHITE_ON_BLACK       0x04  // Used by epaper display
 #define OLEDM_ROTATE_180           0x08  // Rotates display 180 degrees (if supported)
 #define OLEDM_WRITE_COLOR_RAM      0x10  // Use color ram on epaper displays
+#define OLEDM_COLUMN_MAJOR         0x20  // Pixels fill the window a column at a time (SSD1680 only)
 
 // Initializes the display structure and display.  In a generic way.
 //  The process is:
@@ -217,6 +229,26 @@ void oledm_set_memory_bounds(struct OLEDM* display,
 
 // Monochrome OLED pixel interface (emulated when using a color display)
 void oledm_write_pixels(struct OLEDM* display, uint8_t byte);
+// Faster versions of calling oledm_write_pixels() in a loop.  A run writes
+// the same byte count times.  A buf writes len bytes from buf, which is in
+// flash (PROGMEM) if progmem is non-zero.
+void oledm_write_pixel_run(struct OLEDM* display, uint8_t byte, uint16_t count);
+void oledm_write_pixel_buf(
+    struct OLEDM* display, const uint8_t* buf, uint16_t len, bool_t progmem);
+// The same as above but for bytes that already have the top pixel in bit 7,
+// e.g. fonts made with make_var_font.py reverse_bits.  On the SSD1680 these
+// skip the bit reversal that the other pixel functions do on every byte.
+void oledm_write_reversed_run(struct OLEDM* display, uint8_t byte, uint16_t count);
+void oledm_write_reversed_buf(
+    struct OLEDM* display, const uint8_t* buf, uint16_t len, bool_t progmem);
+
+// Swaps bit 0 with bit 7, 1 with 6 and so on
+static inline uint8_t oledm_reverse_byte(uint8_t x) {
+    x = ((x >> 1) & 0x55) | ((x << 1) & 0xaa);
+    x = ((x >> 2) & 0x33) | ((x << 2) & 0xcc);
+    x = ((x >> 4) & 0x0f) | ((x << 4) & 0xf0);
+    return x;
+}
 
 #ifdef OLEDM_COLOR16
   #define rgb16(R, G, B) (((R) << 11) | ((G) << 5) | (B))
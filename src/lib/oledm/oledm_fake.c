@@ -1,8 +1,11 @@
 #include "oledm_fake.h"
+#include <avr/pgmspace.h>
 #include <string.h>
 
 uint32_t oledm_log[16384];
 uint16_t oledm_logidx;
+uint16_t oledm_write_calls;
+uint16_t oledm_write_reversed_calls;
 
 #define LOG(v) oledm_log[oledm_logidx++] = (v)
 
@@ -67,6 +70,42 @@ void oledm_set_memory_bounds(struct OLEDM* display,
 }
 
 void oledm_write_pixels(struct OLEDM* display, uint8_t byte) {
+  ++oledm_write_calls;
   LOG(OLEDM_WRITE_PIXELS);
   LOG(byte);
 }
+
+void oledm_write_pixel_run(struct OLEDM* display, uint8_t byte, uint16_t count) {
+  ++oledm_write_calls;
+  for (; count; --count) {
+    LOG(OLEDM_WRITE_PIXELS);
+    LOG(byte);
+  }
+}
+
+void oledm_write_pixel_buf(
+    struct OLEDM* display, const uint8_t* buf, uint16_t len, bool_t progmem) {
+  ++oledm_write_calls;
+  for (; len; --len, ++buf) {
+    LOG(OLEDM_WRITE_PIXELS);
+    LOG(progmem ? pgm_read_byte_near(buf) : *buf);
+  }
+}
+
+// The reversed functions are logged in normal bit order so that tests can
+// compare them with the other pixel functions.
+void oledm_write_reversed_run(
+    struct OLEDM* display, uint8_t byte, uint16_t count) {
+  ++oledm_write_reversed_calls;
+  oledm_write_pixel_run(display, oledm_reverse_byte(byte), count);
+}
+
+void oledm_write_reversed_buf(
+    struct OLEDM* display, const uint8_t* buf, uint16_t len, bool_t progmem) {
+  ++oledm_write_reversed_calls;
+  ++oledm_write_calls;
+  for (; len; --len, ++buf) {
+    LOG(OLEDM_WRITE_PIXELS);
+    LOG(oledm_reverse_byte(progmem ? pgm_read_byte_near(buf) : *buf));
+  }
+}
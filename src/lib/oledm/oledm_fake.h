@@ -22,9 +22,16 @@
 
 extern uint32_t oledm_log[];
 extern uint16_t oledm_logidx;
+// Number of calls made to write pixels.  Runs and buffers are logged as
+// individual OLEDM_WRITE_PIXELS entries but only count as one call here.
+extern uint16_t oledm_write_calls;
+// Number of those calls that were oledm_write_reversed_*()
+extern uint16_t oledm_write_reversed_calls;
 
 static inline void oledm_log_reset() {
     oledm_logidx = 0;
+    oledm_write_calls = 0;
+    oledm_write_reversed_calls = 0;
 }
 
 #endif
@@ -2,8 +2,13 @@
 #include <error_codes.h>
 #include "oledm.h"
 #include "oledm_spi.h"
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 
+// With SPI_ASYNC, bytes are queued and sent by the SPI interrupt.  Anything
+// that changes CS or D/C waits for the queue to drain first so that every
+// byte is sent with the pin states it was written under.
+
 void oledm_ifaceInit(void) {
   CS_DDR |= (1 << CS_PIN);
   CS_PORT |= (1 << CS_PIN);
@@ -19,6 +24,9 @@ void oledm_ifaceInit(void) {
 }
 
 void oledm_startCommands(error_t* err) {
+#ifdef SPI_ASYNC
+  spi_asyncFlush();
+#endif
   DC_PORT &= ~(1 << DC_PIN);
   CS_PORT &= ~(1 << CS_PIN);
 }
@@ -29,15 +37,48 @@ void oledm_start_pixels(struct OLEDM* display) {
 }
 #endif
 
+#ifdef SPI_ASYNC
+void oledm_command(uint8_t cmd, error_t* err) {
+  spi_asyncWriteRun(cmd, 1);
+}
+
+void oledm_commandBuf(
+    const uint8_t* buf, uint16_t len, bool_t progmem, error_t* err) {
+  spi_asyncWriteBuf(buf, len, progmem);
+}
+
+void oledm_ifaceWriteData(uint8_t data, error_t* err) {
+  spi_asyncWriteRun(data, 1);
+}
+
+void oledm_ifaceWriteRun(uint8_t data, uint16_t count, error_t* err) {
+  spi_asyncWriteRun(data, count);
+}
+#else
 void oledm_command(uint8_t cmd, error_t* err) {
   spi_syncWrite(cmd);
 }
 
+void oledm_commandBuf(
+    const uint8_t* buf, uint16_t len, bool_t progmem, error_t* err) {
+  for (; len; --len, ++buf) {
+    spi_syncWrite(progmem ? pgm_read_byte_near(buf) : *buf);
+  }
+}
+
 void oledm_ifaceWriteData(uint8_t data, error_t* err) {
   spi_syncWrite(data);
 }
 
+void oledm_ifaceWriteRun(uint8_t data, uint16_t count, error_t* err) {
+  spi_syncWriteRun(data, count);
+}
+#endif
+
 void oledm_stop(struct OLEDM* display) {
+#ifdef SPI_ASYNC
+  spi_asyncFlush();
+#endif
   CS_PORT |= (1 << CS_PIN);
   DC_PORT |= (1 << DC_PIN);
 }
@@ -4,11 +4,15 @@
 
 #include "epaper.h"
 
+#include <avr/interrupt.h>
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 #include <string.h>
 #include <error_codes.h>
 #include "oledm_spi.h"
+#ifdef SPI_ASYNC
+#include <spi/spi.h>
+#endif
 #include "oledm_driver_common.inc"
 #include <util/delay.h>
 
@@ -24,6 +28,7 @@ enum ESsd1608Commands
     SSD1680_DEEP_SLEEP_MODE          = 0x10,
     SSD1680_DATA_ENTRY_MODE          = 0x11,
     SSD1680_SW_RESET                 = 0x12,
+    SSD1680_WRITE_TEMPERATURE        = 0x1A,
     SSD1680_MASTER_ACTIVATION        = 0x20,
     SSD1680_DISPLAY_UPDATE_CONTROL1  = 0x21,
     SSD1680_DISPLAY_UPDATE_CONTROL2  = 0x22,
@@ -47,10 +52,18 @@ enum ESsd1608Commands
     SSD1680_END_OPTION               = 0x3F,
     SSD1680_SET_X_START_END          = 0x44,
     SSD1680_SET_Y_START_END          = 0x45,
+    SSD1680_AUTO_WRITE_RAM_RED       = 0x46,
+    SSD1680_AUTO_WRITE_RAM_BW        = 0x47,
     SSD1680_SET_X_ADDRESS_COUNTER    = 0x4E,
     SSD1680_SET_Y_ADDRESS_COUNTER    = 0x4F,
 };
 
+// Set to 0 for controllers that do not support the auto write RAM commands.
+// oledm_clear() will then send every byte of the RAM instead.
+#ifndef SSD1680_AUTO_WRITE_RAM
+#define SSD1680_AUTO_WRITE_RAM 1
+#endif
+
 #define DISPLAY_MEMORY_ROWS 16
 #define DISPLAY_MEMORY_COLUMNS 296
 
@@ -59,6 +72,8 @@ enum ESsd1608Commands
 #define BUSY_PORT PORTD
 #define BUSY_INPUT PIND
 #define BUSY_PIN 7  // D7
+#define BUSY_PCMSK PCMSK2  // PCINT23
+#define BUSY_PCIE PCIE2
 #endif
 
 const uint8_t WF_PARTIAL_2IN9[159] PROGMEM = {
@@ -112,34 +127,76 @@ const uint8_t WRITE_REG_FOR_DISPLAY_PARTIAL[10] PROGMEM = {
     0x00, 0x00
 };
 
-static inline uint8_t reverse_byte(uint8_t x) {
-    x = ((x >> 1) & 0x55) | ((x << 1) & 0xaa);
-    x = ((x >> 2) & 0x33) | ((x << 2) & 0xcc);
-    x = ((x >> 4) & 0x0f) | ((x << 4) & 0xf0);
-    return x;
-}
-
 uint8_t epaper_is_busy(void) {
   return (BUSY_INPUT & (1 << BUSY_PIN)) != 0;
 }
 
+// See epaper_set_busy_sleep()
+static void (*busy_sleep)(void);
+static uint8_t (*busy_seconds)(void);
+
+void epaper_set_busy_sleep(void (*sleep)(void), uint8_t (*seconds)(void)) {
+  busy_sleep = sleep;
+  busy_seconds = seconds;
+}
+
+// The BUSY pin change interrupt is only needed to wake the MCU.  The ISR is
+// up to the application since the vector is usually shared with other pins.
+#define BUSY_TIMEOUT_SECONDS 5
+static uint8_t sleep_while_busy(void) {
+  const uint8_t start = busy_seconds();
+  const uint8_t pcicr = PCICR & (1 << BUSY_PCIE);
+  const uint8_t pcmsk = BUSY_PCMSK & (1 << BUSY_PIN);
+  uint8_t timeout = 0;
+  PCICR |= (1 << BUSY_PCIE);
+  BUSY_PCMSK |= (1 << BUSY_PIN);
+  while (1) {
+    if ((uint8_t)(busy_seconds() - start) >= BUSY_TIMEOUT_SECONDS) {
+      timeout = epaper_is_busy();
+      break;
+    }
+    // BUSY is checked with interrupts off and busy_sleep() only enables them
+    // right before sleep_cpu().  Thus if BUSY drops after the check, the pin
+    // change interrupt is still pending and wakes the MCU right away.
+    cli();
+    if (!epaper_is_busy()) {
+      break;
+    }
+    busy_sleep();
+  }
+  sei();
+  BUSY_PCMSK = (BUSY_PCMSK & ~(1 << BUSY_PIN)) | pcmsk;
+  PCICR = (PCICR & ~(1 << BUSY_PCIE)) | pcicr;
+  return timeout;
+}
+
 #define BUSY_TIMEOUT_MS 4000
 void epaper_wait(struct OLEDM* display) {
   error_t* err = &(display->error);
-  uint16_t i = 0;
-  for (;
-       i < BUSY_TIMEOUT_MS && (BUSY_INPUT & (1 << BUSY_PIN));
-       ++i) {
-    _delay_ms(1);
+  uint8_t timeout;
+  if (busy_sleep) {
+    timeout = sleep_while_busy();
+  } else {
+    uint16_t i = 0;
+    for (;
+         i < BUSY_TIMEOUT_MS && (BUSY_INPUT & (1 << BUSY_PIN));
+         ++i) {
+      _delay_ms(1);
+    }
+    timeout = i >= BUSY_TIMEOUT_MS;
   }
 
   _delay_ms(4);
-  if (i >= BUSY_TIMEOUT_MS) {
+  if (timeout) {
     *err = NO_ACK_ERROR;
   }
 }
 
 static inline void command_data() {
+#ifdef SPI_ASYNC
+  // the command byte has to be sent with D/C low
+  spi_asyncFlush();
+#endif
   DC_PORT |= (1 << DC_PIN);
   CS_PORT &= ~(1 << CS_PIN);
 }
@@ -151,6 +208,13 @@ void oledm_basic_init(struct OLEDM* display) {
   display->memory_columns = DISPLAY_MEMORY_COLUMNS;
   display->memory_rows = DISPLAY_MEMORY_ROWS;
   display->option_bits = 0x00;
+  display->epaper_temperature = EPAPER_NO_TEMPERATURE;
+}
+
+// Called after a reset.  The controller registers go back to their power on
+// values but RAM is kept.
+static void forget_registers(struct OLEDM* display) {
+  display->epaper_state &= (EPAPER_RAM_RETAINED | EPAPER_AWAKE);
 }
 
 static void set_lut(struct OLEDM* display, const uint8_t* lut) {
@@ -159,10 +223,7 @@ static void set_lut(struct OLEDM* display, const uint8_t* lut) {
   oledm_startCommands(err);
   oledm_command(SSD1680_WRITE_LUT_REGISTER, err);
   command_data();
-  uint8_t idx = 0;
-  for (; idx < 153; ++idx) {
-    oledm_command(pgm_read_byte_near(&lut[idx]), err);
-  }
+  oledm_commandBuf(lut, 153, 1, err);
   oledm_stop(display);
   epaper_wait(display);
 }
@@ -174,7 +235,48 @@ void epaper_reset(void) {
   _delay_ms(2);
 }
 
+// Loads the full update waveform that the panel keeps in OTP.  The OTP
+// holds one waveform per temperature band and the band is picked from the
+// temperature register, which is written here instead of having the
+// controller read its own sensor.
+static void load_otp_lut(struct OLEDM* display) {
+  error_t* err = &(display->error);
+  oledm_startCommands(err);
+  oledm_command(SSD1680_WRITE_TEMPERATURE, err);
+  command_data();
+  oledm_command((uint8_t)display->epaper_temperature, err);
+  oledm_command(0x00, err);  // fractional part
+  oledm_stop(display);
+
+  oledm_startCommands(err);
+  oledm_command(SSD1680_DISPLAY_UPDATE_CONTROL2, err);
+  command_data();
+  oledm_command(0x91, err);  // enable clock, load LUT, disable clock
+  oledm_stop(display);
+
+  oledm_startCommands(err);
+  oledm_command(SSD1680_MASTER_ACTIVATION, err);
+  oledm_stop(display);
+  epaper_wait(display);
+}
+
+void epaper_set_temperature(struct OLEDM* display, int8_t celsius) {
+  if (celsius != display->epaper_temperature) {
+    display->epaper_temperature = celsius;
+    display->epaper_state &= ~EPAPER_FULL_LUT;
+  }
+}
+
 void epaper_set_full_mode(struct OLEDM* display) {
+  if (display->epaper_state & EPAPER_FULL_LUT) {
+    return;
+  }
+  if (display->epaper_temperature != EPAPER_NO_TEMPERATURE) {
+    load_otp_lut(display);
+    display->epaper_state &= ~EPAPER_PARTIAL_LUT;
+    display->epaper_state |= EPAPER_FULL_LUT;
+    return;
+  }
   // Do we need a reset here, like partial mode?
   set_lut(display, WS_20_30);
   error_t* err = &(display->error);
@@ -203,28 +305,39 @@ void epaper_set_full_mode(struct OLEDM* display) {
   command_data();
   oledm_command(pgm_read_byte_near(&WS_20_30[158]), err);
   oledm_stop(display);
+
+  display->epaper_state &= ~EPAPER_PARTIAL_LUT;
+  display->epaper_state |= EPAPER_FULL_LUT;
 }
 
-void epaper_set_partial_mode(struct OLEDM* display) {
+// Loads the partial waveform (unless it already is) and turns on the
+// clock and analog blocks.
+static void load_partial_mode(struct OLEDM* display) {
   error_t* err = &(display->error);
 
-  epaper_reset();
-  set_lut(display, WF_PARTIAL_2IN9);
-
-  oledm_startCommands(err);
-  oledm_command(SSD1680_WRITE_REG_FOR_DISPLAY, err);
-  command_data();
-  for (uint8_t i=0; i<sizeof(WRITE_REG_FOR_DISPLAY_PARTIAL); ++i) {
-    oledm_command(pgm_read_byte_near(&WRITE_REG_FOR_DISPLAY_PARTIAL[i]), err);
+  if (!(display->epaper_state & EPAPER_PARTIAL_LUT)) {
+    set_lut(display, WF_PARTIAL_2IN9);
+
+    oledm_startCommands(err);
+    oledm_command(SSD1680_WRITE_REG_FOR_DISPLAY, err);
+    command_data();
+    oledm_commandBuf(
+        WRITE_REG_FOR_DISPLAY_PARTIAL,
+        sizeof(WRITE_REG_FOR_DISPLAY_PARTIAL),
+        1,
+        err);
+    oledm_stop(display);
+
+    oledm_startCommands(err);
+    oledm_command(SSD1680_BORDER_WAVEFORM_CONTROL, err);
+    command_data();
+    // VBD=VCOM, VBD_LEVEL=VSS, GS_transition=FollowLUT, GS_transition=LUT0
+    oledm_command(0x80, err);
+    oledm_stop(display);
+
+    display->epaper_state &= ~EPAPER_FULL_LUT;
+    display->epaper_state |= EPAPER_PARTIAL_LUT;
   }
-  oledm_stop(display);
-
-  oledm_startCommands(err);
-  oledm_command(SSD1680_BORDER_WAVEFORM_CONTROL, err);
-  command_data();
-  // VBD=VCOM, VBD_LEVEL=VSS, GS_transition=FollowLUT, GS_transition=LUT0
-  oledm_command(0x80, err);
-  oledm_stop(display);
 
   oledm_startCommands(err);
   oledm_command(SSD1680_DISPLAY_UPDATE_CONTROL2, err);
@@ -239,10 +352,28 @@ void epaper_set_partial_mode(struct OLEDM* display) {
   epaper_wait(display);
 }
 
+void epaper_set_partial_mode(struct OLEDM* display) {
+  if (!(display->epaper_state & EPAPER_AWAKE)) {
+    // A reset is the only way out of deep sleep
+    epaper_reset();
+    forget_registers(display);
+    display->epaper_state |= EPAPER_AWAKE;
+  }
+  load_partial_mode(display);
+}
+
 #define STARTUP_ATTEMPTS 3
-void oledm_start(struct OLEDM* display) {
+// Initializes the interface and waits for the controller to come out of
+// reset.  Returns non-zero if the controller never responded.
+static uint8_t wake_controller(struct OLEDM* display) {
   error_t* err = &(display->error);
-  oledm_ifaceInit();
+  if (display->epaper_state & EPAPER_AWAKE) {
+    // Never went to sleep so everything is as it was left
+    return *err;
+  }
+
+  oledm_ifaceInit();  // includes a hardware reset
+  forget_registers(display);
   BUSY_DDR &= ~(1 << BUSY_PIN);
   BUSY_PORT &= ~(1 << BUSY_PIN);
 
@@ -259,17 +390,16 @@ void oledm_start(struct OLEDM* display) {
     epaper_reset();
   }
 
-  if (*err) {
-    // failed to start up
-    return;
+  if (!*err) {
+    display->epaper_state |= EPAPER_AWAKE;
   }
+  return *err;
+}
 
-
-  oledm_startCommands(err);
-  oledm_command(SSD1680_SW_RESET, err);
-  oledm_stop(display);
-  epaper_wait(display);
-
+// Sets up the number of gates and scan direction.  These are also the power
+// on values so this is only needed when the controller state is unknown.
+static void set_driver_output(struct OLEDM* display) {
+  error_t* err = &(display->error);
   oledm_startCommands(err);
   oledm_command(SSD1680_DRIVER_OUTPUT, err);
   command_data();
@@ -277,13 +407,36 @@ void oledm_start(struct OLEDM* display) {
   oledm_command(0x01, err);
   oledm_command(0x00, err);  // Scan down and to the right
   oledm_stop(display);
+}
 
+// Sends the data entry mode for the current option_bits.  The address
+// counter moves along a row and then to the next row (AM=1) unless
+// OLEDM_COLUMN_MAJOR is set.
+static void set_data_entry_mode(struct OLEDM* display) {
+  error_t* err = &(display->error);
+  uint8_t mode = display->option_bits & OLEDM_ROTATE_180 ? 0x05 : 0x06;
+  if (display->option_bits & OLEDM_COLUMN_MAJOR) {
+    mode &= ~0x04;
+  }
   oledm_startCommands(err);
   oledm_command(SSD1680_DATA_ENTRY_MODE, err);
   command_data();
-  oledm_command(
-      display->option_bits & OLEDM_ROTATE_180 ? 0x05 : 0x06, err);
+  oledm_command(mode, err);
   oledm_stop(display);
+}
+
+// Sets up data entry mode and RAM options for the current option_bits.
+// Does nothing if they are already set up.
+static void init_registers(struct OLEDM* display) {
+  error_t* err = &(display->error);
+  const uint8_t registers = display->option_bits &
+    (OLEDM_ROTATE_180 | OLEDM_WHITE_ON_BLACK | OLEDM_COLUMN_MAJOR);
+  if ((display->epaper_state & EPAPER_REGISTERS_SET) &&
+      (display->epaper_registers == registers)) {
+    return;
+  }
+
+  set_data_entry_mode(display);
 
   oledm_startCommands(err);
   oledm_command(SSD1680_DISPLAY_UPDATE_CONTROL1, err);
@@ -294,16 +447,59 @@ void oledm_start(struct OLEDM* display) {
   oledm_command(0x80, err);
   oledm_stop(display);
 
+  display->epaper_registers = registers;
+  // The window depends on rotation
+  display->epaper_state |= EPAPER_REGISTERS_SET;
+  display->epaper_state &= ~EPAPER_WINDOW_SET;
+}
+
+void oledm_start(struct OLEDM* display) {
+  error_t* err = &(display->error);
+  // Read this before waking since it depends on how the display went to sleep
+  const uint8_t known_state = epaper_ram_is_retained(display);
+  if (wake_controller(display)) {
+    // failed to start up
+    return;
+  }
+
+  if (!known_state) {
+    // Power up or recovering from an error.  Otherwise, the controller was
+    // put to sleep by us and the hardware reset it took to wake it already
+    // put the registers back to their power on values.
+    oledm_startCommands(err);
+    oledm_command(SSD1680_SW_RESET, err);
+    oledm_stop(display);
+    epaper_wait(display);
+    forget_registers(display);
+    set_driver_output(display);
+  }
+
+  init_registers(display);
   oledm_set_memory_bounds(
       display,
       0,
       0,
       DISPLAY_MEMORY_COLUMNS - 1,
       DISPLAY_MEMORY_ROWS - 1);
-
   epaper_set_full_mode(display);
 }
 
+void epaper_start_partial(struct OLEDM* display) {
+  const uint8_t known_state = epaper_ram_is_retained(display);
+  if (wake_controller(display)) {
+    return;
+  }
+
+  if (!known_state) {
+    set_driver_output(display);
+  }
+  // Skips the SW reset and full waveform upload done by oledm_start()
+  init_registers(display);
+  load_partial_mode(display);
+}
+
+// None of the window or pointer commands keep the controller busy so there
+// is no epaper_wait() here.
 static void set_memory_pointer(
     struct OLEDM* display, column_t column, uint8_t row) {
   error_t* err = &(display->error);
@@ -329,9 +525,11 @@ static void set_memory_pointer(
   oledm_command(mcol >> 8, err);
   oledm_stop(display);
 
-  epaper_wait(display);
+  display->epaper_state |= EPAPER_POINTER_SET;
 }
 
+// Only sends the parts of the window that changed.  For example, characters
+// on the same line of text only need new columns.
 void oledm_set_memory_bounds(
     struct OLEDM* display,
     column_t left_column,
@@ -340,78 +538,174 @@ void oledm_set_memory_bounds(
     uint8_t bottom_row) {
 
   error_t* err = &(display->error);
+  const uint8_t state = display->epaper_state;
+
+  if (!(state & EPAPER_ROWS_SET) ||
+      (display->epaper_top_row != top_row) ||
+      (display->epaper_bottom_row != bottom_row)) {
+    oledm_startCommands(err);
+    oledm_command(SSD1680_SET_X_START_END, err);
+    command_data();
+    if (display->option_bits & OLEDM_ROTATE_180) {
+      oledm_command(top_row, err);
+      oledm_command(bottom_row, err);
+    } else {
+      oledm_command(DISPLAY_MEMORY_ROWS - top_row - 1, err);
+      oledm_command(DISPLAY_MEMORY_ROWS - bottom_row - 1, err);
+    }
+    oledm_stop(display);
 
-  oledm_startCommands(err);
-  oledm_command(SSD1680_SET_X_START_END, err);
-  command_data();
-  if (display->option_bits & OLEDM_ROTATE_180) {
-    oledm_command(top_row, err);
-    oledm_command(bottom_row, err);
-  } else {
-    oledm_command(DISPLAY_MEMORY_ROWS - top_row - 1, err);
-    oledm_command(DISPLAY_MEMORY_ROWS - bottom_row - 1, err);
+    display->epaper_top_row = top_row;
+    display->epaper_bottom_row = bottom_row;
+    display->epaper_state &= ~EPAPER_POINTER_SET;
+    display->epaper_state |= EPAPER_ROWS_SET;
   }
-  oledm_stop(display);
 
-  oledm_startCommands(err);
-  oledm_command(SSD1680_SET_Y_START_END, err);
-  command_data();
+  if (!(state & EPAPER_COLUMNS_SET) ||
+      (display->epaper_left_column != left_column) ||
+      (display->epaper_right_column != right_column)) {
+    oledm_startCommands(err);
+    oledm_command(SSD1680_SET_Y_START_END, err);
+    command_data();
 
-  const column_t lc =
-    display->option_bits & OLEDM_ROTATE_180 ?
-        DISPLAY_MEMORY_COLUMNS - left_column - 1 :
-        left_column;
+    const column_t lc =
+      display->option_bits & OLEDM_ROTATE_180 ?
+          DISPLAY_MEMORY_COLUMNS - left_column - 1 :
+          left_column;
 
-  oledm_command(lc & 0xFF, err);
-  oledm_command(lc >> 8, err);
+    oledm_command(lc & 0xFF, err);
+    oledm_command(lc >> 8, err);
 
-  const column_t rc =
-    display->option_bits & OLEDM_ROTATE_180 ?
-        DISPLAY_MEMORY_COLUMNS - right_column - 1 :
-        right_column;
+    const column_t rc =
+      display->option_bits & OLEDM_ROTATE_180 ?
+          DISPLAY_MEMORY_COLUMNS - right_column - 1 :
+          right_column;
 
-  oledm_command(rc & 0xFF, err);
-  oledm_command(rc >> 8, err);
+    oledm_command(rc & 0xFF, err);
+    oledm_command(rc >> 8, err);
 
-  oledm_stop(display);
+    oledm_stop(display);
 
-  set_memory_pointer(display, left_column, top_row);
+    display->epaper_left_column = left_column;
+    display->epaper_right_column = right_column;
+    display->epaper_state &= ~EPAPER_POINTER_SET;
+    display->epaper_state |= EPAPER_COLUMNS_SET;
+  }
+
+  // The pointer is still at the start of the window unless pixels were
+  // written since it was set.
+  if (!(display->epaper_state & EPAPER_POINTER_SET)) {
+    set_memory_pointer(display, left_column, top_row);
+  }
+}
+
+// OLEDM_COLUMN_MAJOR is usually only set for one window, so it is checked
+// whenever pixels are started instead of waiting for oledm_start().
+static void update_data_entry_mode(struct OLEDM* display) {
+  if ((display->epaper_state & EPAPER_REGISTERS_SET) &&
+      ((display->epaper_registers ^ display->option_bits) & OLEDM_COLUMN_MAJOR)) {
+    set_data_entry_mode(display);
+    display->epaper_registers ^= OLEDM_COLUMN_MAJOR;
+  }
 }
 
 void oledm_start_pixels(struct OLEDM* display) {
   error_t* err = &(display->error);
+  update_data_entry_mode(display);
   oledm_startCommands(err);
   oledm_command(
       display->option_bits & OLEDM_WRITE_COLOR_RAM ?
       SSD1680_WRITE_RAM_RED :
       SSD1680_WRITE_RAM_BW, err);
   command_data();
+  display->epaper_state &= ~EPAPER_POINTER_SET;
 }
 
 void epaper_start_color_pixels(struct OLEDM* display) {
   error_t* err = &(display->error);
+  update_data_entry_mode(display);
   oledm_startCommands(err);
   oledm_command(SSD1680_WRITE_RAM_RED, err);
   command_data();
+  display->epaper_state &= ~EPAPER_POINTER_SET;
 }
 
 void oledm_write_pixels(struct OLEDM* display, uint8_t byte) {
-  oledm_ifaceWriteData(reverse_byte(byte), &(display->error));
+  oledm_ifaceWriteData(oledm_reverse_byte(byte), &(display->error));
 }
 
-void oledm_clear(struct OLEDM* display, uint8_t byte) {
-  byte = reverse_byte(byte);
+void oledm_write_pixel_run(struct OLEDM* display, uint8_t byte, uint16_t count) {
+  oledm_ifaceWriteRun(oledm_reverse_byte(byte), count, &(display->error));
+}
+
+void oledm_write_pixel_buf(
+    struct OLEDM* display, const uint8_t* buf, uint16_t len, bool_t progmem) {
+  error_t* err = &(display->error);
+  for (; len; --len, ++buf) {
+    const uint8_t byte = progmem ? pgm_read_byte_near(buf) : *buf;
+    oledm_ifaceWriteData(oledm_reverse_byte(byte), err);
+  }
+}
+
+void oledm_write_reversed_run(
+    struct OLEDM* display, uint8_t byte, uint16_t count) {
+  oledm_ifaceWriteRun(byte, count, &(display->error));
+}
+
+void oledm_write_reversed_buf(
+    struct OLEDM* display, const uint8_t* buf, uint16_t len, bool_t progmem) {
+  // Sent with D/C high, like any other data
+  oledm_commandBuf(buf, len, progmem, &(display->error));
+}
+
+// Fills all of the BW or RED RAM with byte.
+static void clear_ram(struct OLEDM* display, uint8_t ram, uint8_t byte) {
+  error_t* err = &(display->error);
   oledm_set_memory_bounds(
       display, 0, 0, display->memory_columns - 1, display->memory_rows - 1);
-  oledm_start_pixels(display);
-  const uint16_t num_bytes = display->memory_rows * display->memory_columns;
-  for (uint16_t i=0; i < num_bytes; ++i) {
-    // call direct to avoid the double bit reverse
-    oledm_ifaceWriteData(byte, &(display->error));
+
+  if (SSD1680_AUTO_WRITE_RAM && ((byte == 0x00) || (byte == 0xFF))) {
+    // The controller can fill the RAM by itself as long as every bit is the
+    // same.  This saves sending 4736 bytes.
+    oledm_startCommands(err);
+    oledm_command(
+        ram == SSD1680_WRITE_RAM_RED ?
+        SSD1680_AUTO_WRITE_RAM_RED :
+        SSD1680_AUTO_WRITE_RAM_BW,
+        err);
+    command_data();
+    // Bit 7 is the value.  The rest select the largest step sizes so a
+    // single step covers all of RAM.
+    oledm_command((byte & 0x80) | 0x77, err);
+    oledm_stop(display);
+    epaper_wait(display);
+    // Not clear from the datasheet if the window is kept
+    display->epaper_state &= ~EPAPER_WINDOW_SET;
+    return;
   }
+
+  oledm_startCommands(err);
+  oledm_command(ram, err);
+  command_data();
+  display->epaper_state &= ~EPAPER_POINTER_SET;
+  oledm_write_pixel_run(
+      display, byte, display->memory_rows * display->memory_columns);
   oledm_stop(display);
 }
 
+void oledm_clear(struct OLEDM* display, uint8_t byte) {
+  clear_ram(
+      display,
+      display->option_bits & OLEDM_WRITE_COLOR_RAM ?
+      SSD1680_WRITE_RAM_RED :
+      SSD1680_WRITE_RAM_BW,
+      byte);
+}
+
+void epaper_clear_color_ram(struct OLEDM* display, uint8_t byte) {
+  clear_ram(display, SSD1680_WRITE_RAM_RED, byte);
+}
+
 static void swap_buffers(struct OLEDM* display, uint8_t partial) {
   error_t* err = &(display->error);
 
@@ -453,6 +747,15 @@ void epaper_sleep_mode(struct OLEDM* display, EpaperSleepMode sleep_mode) {
     return;
   }
   error_t* err = &(display->error);
+  if (sleep_mode == SLEEP_MODE_1) {
+    display->epaper_state |= EPAPER_RAM_RETAINED;
+  } else {
+    display->epaper_state &= ~EPAPER_RAM_RETAINED;
+  }
+  if (sleep_mode != SLEEP_MODE_0) {
+    // Waking up will need a reset
+    display->epaper_state &= ~EPAPER_AWAKE;
+  }
 
   oledm_startCommands(err);
   oledm_command(SSD1680_DEEP_SLEEP_MODE, err);
@@ -460,3 +763,7 @@ void epaper_sleep_mode(struct OLEDM* display, EpaperSleepMode sleep_mode) {
   oledm_command(sleep_mode & 0x03, err);
   oledm_stop(display);
 }
+
+uint8_t epaper_ram_is_retained(const struct OLEDM* display) {
+  return !display->error && (display->epaper_state & EPAPER_RAM_RETAINED);
+}
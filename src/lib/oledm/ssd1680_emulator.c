@@ -0,0 +1,339 @@
+#include "ssd1680_emulator.h"
+#include "oledm_spi.h"
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Only the commands that ssd1680.c uses, and only the parts of them that
+// change what the RAM or panel ends up holding.
+enum SSD1680EmulatorCommand {
+  DEEP_SLEEP_MODE = 0x10,
+  DATA_ENTRY_MODE = 0x11,
+  SW_RESET = 0x12,
+  MASTER_ACTIVATION = 0x20,
+  DISPLAY_UPDATE_CONTROL1 = 0x21,
+  DISPLAY_UPDATE_CONTROL2 = 0x22,
+  WRITE_RAM_BW = 0x24,
+  WRITE_RAM_RED = 0x26,
+  SET_X_START_END = 0x44,
+  SET_Y_START_END = 0x45,
+  AUTO_WRITE_RAM_RED = 0x46,
+  AUTO_WRITE_RAM_BW = 0x47,
+  SET_X_ADDRESS_COUNTER = 0x4E,
+  SET_Y_ADDRESS_COUNTER = 0x4F,
+};
+
+#define RAM_SIZE (SSD1680_EMULATOR_COLUMNS * SSD1680_EMULATOR_ROWS)
+#define UNDEFINED_RAM 0xA5
+
+struct SSD1680EmulatorStats ssd1680_emulator_stats;
+
+// RAM is addressed as [y][x].  y is the column and x is the 8 pixel row,
+// counted from the bottom.
+static uint8_t bw_ram[SSD1680_EMULATOR_COLUMNS][SSD1680_EMULATOR_ROWS];
+static uint8_t red_ram[SSD1680_EMULATOR_COLUMNS][SSD1680_EMULATOR_ROWS];
+// Black pixels after the last refresh, same layout as the RAM
+static uint8_t panel[SSD1680_EMULATOR_COLUMNS][SSD1680_EMULATOR_ROWS];
+
+// Registers
+static uint8_t data_entry_mode;
+static uint8_t update_control1;
+static uint8_t update_control2;
+static uint8_t x_start;
+static uint8_t x_end;
+static uint16_t y_start;
+static uint16_t y_end;
+static uint8_t x_counter;
+static uint16_t y_counter;
+
+// Command parsing
+static uint8_t command;
+static uint8_t param_count;
+static uint8_t params[4];
+
+static const char* dump_prefix;
+static uint16_t dump_count;
+
+static void reset_registers(void) {
+  data_entry_mode = 0x03;
+  update_control1 = 0x00;
+  update_control2 = 0xFF;
+  x_start = 0;
+  x_end = SSD1680_EMULATOR_ROWS - 1;
+  y_start = 0;
+  y_end = SSD1680_EMULATOR_COLUMNS - 1;
+  x_counter = 0;
+  y_counter = 0;
+  command = 0;
+  param_count = 0;
+}
+
+void ssd1680_emulator_reset_stats(void) {
+  memset(&ssd1680_emulator_stats, 0, sizeof(ssd1680_emulator_stats));
+}
+
+void ssd1680_emulator_reset(void) {
+  memset(bw_ram, UNDEFINED_RAM, RAM_SIZE);
+  memset(red_ram, UNDEFINED_RAM, RAM_SIZE);
+  memset(panel, 0, RAM_SIZE);
+  reset_registers();
+  ssd1680_emulator_reset_stats();
+  dump_prefix = getenv("SSD1680_EMULATOR_DUMP");
+  dump_count = 0;
+  DC_PORT |= (1 << DC_PIN);
+}
+
+uint32_t ssd1680_emulator_spi_bytes(void) {
+  return ssd1680_emulator_stats.commands + ssd1680_emulator_stats.data_bytes;
+}
+
+static uint8_t ram_bit(uint8_t ram[][SSD1680_EMULATOR_ROWS], uint16_t column, uint8_t y) {
+  // ssd1680.c reverses the bits in a byte and counts rows down from the
+  // top of the RAM.
+  const uint8_t x = SSD1680_EMULATOR_ROWS - 1 - (y >> 3);
+  return (ram[column][x] >> (7 - (y & 7))) & 1;
+}
+
+uint8_t ssd1680_emulator_pixel(uint8_t red, uint16_t column, uint8_t y) {
+  return ram_bit(red ? red_ram : bw_ram, column, y);
+}
+
+uint8_t ssd1680_emulator_panel_pixel(uint16_t column, uint8_t y) {
+  return ram_bit(panel, column, y);
+}
+
+uint8_t ssd1680_emulator_write_pbm(const char* path) {
+  FILE* fp = fopen(path, "w");
+  if (!fp) {
+    return 0;
+  }
+  const uint8_t height = SSD1680_EMULATOR_ROWS * 8;
+  fprintf(fp, "P1\n%d %d\n", SSD1680_EMULATOR_COLUMNS, height);
+  for (uint8_t y = 0; y < height; ++y) {
+    for (uint16_t column = 0; column < SSD1680_EMULATOR_COLUMNS; ++column) {
+      fputc(ssd1680_emulator_panel_pixel(column, y) ? '1' : '0', fp);
+    }
+    fputc('\n', fp);
+  }
+  fclose(fp);
+  return 1;
+}
+
+void ssd1680_emulator_ascii(
+    char* buf, uint16_t left_column, uint8_t top_y, uint16_t width, uint8_t height) {
+  for (uint8_t y = top_y; y < top_y + height; ++y) {
+    for (uint16_t column = left_column; column < left_column + width; ++column) {
+      *buf++ = ssd1680_emulator_pixel(0, column, y) ? '#' : '.';
+    }
+    *buf++ = '\n';
+  }
+  *buf = 0;
+}
+
+static void refresh(void) {
+  if (!(update_control2 & 0x04)) {
+    // Not a display update (power on/off, loading a LUT, ...)
+    return;
+  }
+  // The options in update control 1 can invert the BW RAM.  1 is white.
+  const uint8_t invert = (update_control1 & 0x0F) == 0x08 ? 0xFF : 0x00;
+  const uint8_t* ram = &bw_ram[0][0];
+  uint8_t* black = &panel[0][0];
+
+  struct SSD1680EmulatorStats* s = &ssd1680_emulator_stats;
+  if (update_control2 & 0x08) {
+    // Display mode 2.  The RED RAM holds the previous frame and only the
+    // pixels that differ from it are driven, everything else keeps what
+    // the panel showed before.  The controller then copies the BW RAM over
+    // for the next compare.
+    const uint8_t* old = &red_ram[0][0];
+    for (uint16_t i = 0; i < RAM_SIZE; ++i) {
+      const uint8_t changed = ram[i] ^ old[i];
+      black[i] = (black[i] & ~changed) | (~(ram[i] ^ invert) & changed);
+    }
+    memcpy(red_ram, bw_ram, RAM_SIZE);
+    ++s->partial_refreshes;
+    s->last_refresh = SSD1680_EMULATOR_PARTIAL_REFRESH;
+  } else {
+    for (uint16_t i = 0; i < RAM_SIZE; ++i) {
+      black[i] = ~(ram[i] ^ invert);
+    }
+    ++s->full_refreshes;
+    s->last_refresh = SSD1680_EMULATOR_FULL_REFRESH;
+  }
+
+  if (dump_prefix) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s%03u.pbm", dump_prefix, dump_count++);
+    ssd1680_emulator_write_pbm(path);
+  }
+}
+
+// Moves the address counter to the next byte, following the data entry mode
+static void advance(void) {
+  const int8_t dx = data_entry_mode & 0x01 ? 1 : -1;
+  const int8_t dy = data_entry_mode & 0x02 ? 1 : -1;
+  if (data_entry_mode & 0x04) {
+    // y first
+    if (y_counter == y_end) {
+      y_counter = y_start;
+      x_counter = x_counter == x_end ? x_start : x_counter + dx;
+    } else {
+      y_counter += dy;
+    }
+  } else {
+    if (x_counter == x_end) {
+      x_counter = x_start;
+      y_counter = y_counter == y_end ? y_start : y_counter + dy;
+    } else {
+      x_counter += dx;
+    }
+  }
+}
+
+static void write_ram(uint8_t ram[][SSD1680_EMULATOR_ROWS], uint8_t data) {
+  ++ssd1680_emulator_stats.ram_bytes;
+  if ((x_counter < SSD1680_EMULATOR_ROWS) &&
+      (y_counter < SSD1680_EMULATOR_COLUMNS)) {
+    ram[y_counter][x_counter] = data;
+  } else {
+    ++ssd1680_emulator_stats.stray_bytes;
+  }
+  advance();
+}
+
+static void start_command(uint8_t cmd) {
+  ++ssd1680_emulator_stats.commands;
+  command = cmd;
+  param_count = 0;
+
+  switch (cmd) {
+    case SW_RESET:
+      reset_registers();
+      ++ssd1680_emulator_stats.busy_waits;
+      break;
+    case MASTER_ACTIVATION:
+      ++ssd1680_emulator_stats.busy_waits;
+      refresh();
+      break;
+  }
+}
+
+static void command_param(uint8_t data) {
+  ++ssd1680_emulator_stats.data_bytes;
+
+  switch (command) {
+    case WRITE_RAM_BW:
+      write_ram(bw_ram, data);
+      return;
+    case WRITE_RAM_RED:
+      write_ram(red_ram, data);
+      return;
+  }
+
+  if (param_count < sizeof(params)) {
+    params[param_count] = data;
+  }
+  ++param_count;
+
+  switch (command) {
+    case DEEP_SLEEP_MODE:
+      if ((data & 0x03) == 0x03) {
+        // mode 2 does not keep the RAM
+        memset(bw_ram, UNDEFINED_RAM, RAM_SIZE);
+        memset(red_ram, UNDEFINED_RAM, RAM_SIZE);
+      }
+      break;
+    case DATA_ENTRY_MODE:
+      data_entry_mode = data;
+      break;
+    case DISPLAY_UPDATE_CONTROL1:
+      if (param_count == 1) {
+        update_control1 = data;
+      }
+      break;
+    case DISPLAY_UPDATE_CONTROL2:
+      update_control2 = data;
+      break;
+    case SET_X_START_END:
+      if (param_count == 2) {
+        x_start = params[0];
+        x_end = params[1];
+      }
+      break;
+    case SET_Y_START_END:
+      if (param_count == 4) {
+        y_start = params[0] | (params[1] << 8);
+        y_end = params[2] | (params[3] << 8);
+      }
+      break;
+    case AUTO_WRITE_RAM_RED:
+    case AUTO_WRITE_RAM_BW:
+      // ssd1680.c always fills the whole RAM with one value
+      memset(
+          command == AUTO_WRITE_RAM_BW ? bw_ram : red_ram,
+          data & 0x80 ? 0xFF : 0x00,
+          RAM_SIZE);
+      ++ssd1680_emulator_stats.busy_waits;
+      break;
+    case SET_X_ADDRESS_COUNTER:
+      x_counter = data;
+      break;
+    case SET_Y_ADDRESS_COUNTER:
+      if (param_count == 2) {
+        y_counter = params[0] | (params[1] << 8);
+      }
+      break;
+  }
+}
+
+static void spi_byte(uint8_t data) {
+  if (DC_PORT & (1 << DC_PIN)) {
+    command_param(data);
+  } else {
+    start_command(data);
+  }
+}
+
+//
+// The oledm_spi.c interface
+//
+
+void oledm_ifaceInit(void) {
+  // A hardware reset.  Registers go back to their defaults but RAM is kept.
+  reset_registers();
+  ++ssd1680_emulator_stats.resets;
+  DC_PORT |= (1 << DC_PIN);
+}
+
+void oledm_startCommands(error_t* err) {
+  DC_PORT &= ~(1 << DC_PIN);
+}
+
+void oledm_command(uint8_t cmd, error_t* err) {
+  spi_byte(cmd);
+}
+
+void oledm_commandBuf(
+    const uint8_t* buf, uint16_t len, bool_t progmem, error_t* err) {
+  for (; len; --len, ++buf) {
+    spi_byte(progmem ? pgm_read_byte_near(buf) : *buf);
+  }
+}
+
+void oledm_ifaceWriteData(uint8_t data, error_t* err) {
+  spi_byte(data);
+}
+
+void oledm_ifaceWriteRun(uint8_t data, uint16_t count, error_t* err) {
+  for (; count; --count) {
+    spi_byte(data);
+  }
+}
+
+void oledm_stop(struct OLEDM* display) {
+  DC_PORT |= (1 << DC_PIN);
+}
@@ -0,0 +1,71 @@
+#ifndef LIB_OLEDM_SSD1680_EMULATOR_H
+#define LIB_OLEDM_SSD1680_EMULATOR_H
+
+// Host stand-in for oledm_spi.c when testing ssd1680.c.
+//
+// Instead of logging bytes (like oledm_fake.c or the twi fake), this
+// interprets the SSD1680 commands that ssd1680.c uses and keeps the BW and
+// RED RAM, so tests can check what the panel would show and how many bytes
+// it took to get there.
+//
+// A partial refresh only drives the pixels where the BW RAM differs from the
+// RED RAM, then copies BW to RED.  Thus pixels that the driver forgot to
+// send stay stale on the panel, like they would on the real thing.
+//
+// D/C is taken from DC_PORT, the same as the real controller would see it.
+// BUSY is never set, thus epaper_wait() returns right away.  The commands
+// that would set BUSY are counted instead.
+
+#include "oledm.h"
+#include <inttypes.h>
+
+#define SSD1680_EMULATOR_COLUMNS 296
+#define SSD1680_EMULATOR_ROWS 16  // bytes of 8 pixels, like oledm rows
+
+// Refresh types
+#define SSD1680_EMULATOR_NO_REFRESH 0
+#define SSD1680_EMULATOR_FULL_REFRESH 1
+#define SSD1680_EMULATOR_PARTIAL_REFRESH 2
+
+struct SSD1680EmulatorStats {
+  uint16_t commands;  // bytes sent with D/C low
+  uint32_t data_bytes;  // bytes sent with D/C high, including ram_bytes
+  uint32_t ram_bytes;  // bytes written to the BW or RED RAM
+  uint32_t stray_bytes;  // RAM bytes that landed outside of the RAM
+  uint16_t busy_waits;  // commands that would set BUSY
+  uint8_t resets;  // hardware resets (oledm_ifaceInit)
+  uint8_t full_refreshes;
+  uint8_t partial_refreshes;
+  uint8_t last_refresh;  // SSD1680_EMULATOR_*_REFRESH
+};
+
+extern struct SSD1680EmulatorStats ssd1680_emulator_stats;
+
+// Powers up the emulated controller.  RAM starts out as 0xA5 (undefined on
+// the real thing) and the stats are cleared.  If the SSD1680_EMULATOR_DUMP
+// environment variable is set, every refresh is written to
+// $SSD1680_EMULATOR_DUMP<n>.pbm, with n counting from 0 after each reset.
+void ssd1680_emulator_reset(void);
+void ssd1680_emulator_reset_stats(void);
+
+// Total bytes sent over SPI since the stats were reset
+uint32_t ssd1680_emulator_spi_bytes(void);
+
+// Returns 1 if the pixel is set in the RAM (in oledm terms, before the
+// WHITE_ON_BLACK inversion).  y counts pixels from the top (0-127).
+uint8_t ssd1680_emulator_pixel(uint8_t red_ram, uint16_t column, uint8_t y);
+
+// Returns 1 if the pixel was black on the panel after the last refresh.
+uint8_t ssd1680_emulator_panel_pixel(uint16_t column, uint8_t y);
+
+// Writes the panel image of the last refresh as a PBM file.  Returns
+// non-zero on success.
+uint8_t ssd1680_emulator_write_pbm(const char* path);
+
+// Draws part of the BW RAM into buf as text, one line per pixel row, '#'
+// for set pixels and '.' for clear ones.  buf needs (width + 1) * height + 1
+// bytes.
+void ssd1680_emulator_ascii(
+    char* buf, uint16_t left_column, uint8_t top_y, uint16_t width, uint8_t height);
+
+#endif
@@ -0,0 +1,469 @@
+#define SSD1680
+#include "ssd1680_emulator.h"
+#include "epaper.h"
+#include "graph_display.h"
+#include "text.h"
+
+#include <test/unit_test.h>
+
+// Directly include some deps to avoid making the test makefile more complex
+#include "ssd1680.c"
+#include "text.c"
+#include "graph_display.c"
+
+// SPI byte budgets.  These fail when a change makes the display path send
+// more than it used to.  Lower them when a change makes things cheaper.
+#define COLD_FRAME_BUDGET 265
+#define PARTIAL_LINE_BUDGET 200
+#define GRAPH_BUDGET 614
+
+static struct VariableFont font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 3,
+    .height = 2,
+    .data = {
+      // the data table
+      '+', 3, 0x00, 12,  // 12 bytes to the start of the data
+      '-', 3, 0x00, 19,
+      '|', 1, 0x00, 23,
+
+      // see text_test.c for the pictures
+      0x86, 0x01, 0xFF, 0x01, 0x00, 0xFF, 0x00,
+      0x03, 0x01, 0x03, 0x00,
+      0x02, 0xFF
+    },
+};
+
+// font with VARIABLE_FONT_REVERSED, sent without the bit reversal
+static struct VariableFont reversed_font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 3,
+    .height = 2 | VARIABLE_FONT_REVERSED,
+    .data = {
+      '+', 3, 0x00, 12,
+      '-', 3, 0x00, 19,
+      '|', 1, 0x00, 23,
+
+      0x86, 0x80, 0xFF, 0x80, 0x00, 0xFF, 0x00,
+      0x03, 0x80, 0x03, 0x00,
+      0x02, 0xFF
+    },
+};
+
+static char ascii[1024];
+
+// Renders a full frame the same way that display.c does after power up
+static void render_cold_frame_font(
+    struct OLEDM* display, const char* str, const struct VariableFont* f) {
+  struct Text text;
+  oledm_start(display);
+  text_init(&text, f, display);
+
+  display->option_bits |= OLEDM_WRITE_COLOR_RAM;
+  oledm_clear(display, 0x00);
+  text.column = 10;
+  text.row = 2;
+  text_str(&text, str);
+  display->option_bits &= ~OLEDM_WRITE_COLOR_RAM;
+  oledm_clear(display, 0x00);
+  text.column = 10;
+  text.row = 2;
+  text_str(&text, str);
+
+  epaper_swap_buffers(display, SLEEP_MODE_1);
+}
+
+static void render_cold_frame(struct OLEDM* display, const char* str) {
+  render_cold_frame_font(display, str, &font);
+}
+
+void test_cold_frame(void) {
+  struct OLEDM display;
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+
+  render_cold_frame(&display, "+-|");
+  assert_int_equal(0, display.error);
+
+  const struct SSD1680EmulatorStats* s = &ssd1680_emulator_stats;
+  assert_int_equal(1, s->full_refreshes);
+  assert_int_equal(0, s->partial_refreshes);
+  assert_int_equal(SSD1680_EMULATOR_FULL_REFRESH, s->last_refresh);
+  assert_int_equal(0, s->stray_bytes);
+  // 2 RAMs x 7 columns x 2 rows of text
+  assert_int_equal(28, s->ram_bytes);
+  // SW reset, 2 auto writes, the refresh
+  assert_int_equal(4, s->busy_waits);
+  assert_true(ssd1680_emulator_spi_bytes() <= COLD_FRAME_BUDGET);
+
+  ssd1680_emulator_ascii(ascii, 9, 16, 9, 16);
+  assert_buff_equal(
+      ".#######.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n"
+      "..#....#.\n",
+      ascii,
+      strlen(ascii) + 1);
+
+  // Both RAMs hold the frame and the rest was cleared
+  for (uint8_t y = 0; y < 128; ++y) {
+    for (uint16_t column = 0; column < SSD1680_EMULATOR_COLUMNS; ++column) {
+      assert_int_equal(
+          ssd1680_emulator_pixel(0, column, y),
+          ssd1680_emulator_pixel(1, column, y));
+      // black on white
+      assert_int_equal(
+          ssd1680_emulator_pixel(0, column, y),
+          ssd1680_emulator_panel_pixel(column, y));
+    }
+  }
+  assert_int_equal(0, ssd1680_emulator_pixel(0, 0, 0));
+  assert_int_equal(1, ssd1680_emulator_pixel(0, 11, 31));
+}
+
+void test_dark_mode(void) {
+  struct OLEDM display;
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  display.option_bits |= OLEDM_WHITE_ON_BLACK;
+
+  render_cold_frame(&display, "|");
+  assert_int_equal(0, display.error);
+  // RAM is the same as light mode but the panel shows it inverted
+  assert_int_equal(1, ssd1680_emulator_pixel(0, 10, 16));
+  assert_int_equal(0, ssd1680_emulator_panel_pixel(10, 16));
+  assert_int_equal(1, ssd1680_emulator_panel_pixel(0, 0));
+}
+
+void test_reversed_font(void) {
+  struct OLEDM display;
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  render_cold_frame(&display, "+-|");
+  char expected[1024];
+  ssd1680_emulator_ascii(expected, 9, 16, 9, 16);
+
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  render_cold_frame_font(&display, "+-|", &reversed_font);
+  assert_int_equal(0, display.error);
+  ssd1680_emulator_ascii(ascii, 9, 16, 9, 16);
+  assert_buff_equal(expected, ascii, strlen(expected) + 1);
+}
+
+void test_partial_line(void) {
+  struct OLEDM display;
+  struct Text text;
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  render_cold_frame(&display, "+++");
+  ssd1680_emulator_reset_stats();
+
+  // What display.c does when one line of text changes
+  epaper_start_partial(&display);
+  text_init(&text, &font, &display);
+  text.column = 14;
+  text.row = 2;
+  text_str(&text, "-");
+  epaper_update_partial(&display, SLEEP_MODE_1);
+  assert_int_equal(0, display.error);
+
+  const struct SSD1680EmulatorStats* s = &ssd1680_emulator_stats;
+  assert_int_equal(0, s->full_refreshes);
+  assert_int_equal(1, s->partial_refreshes);
+  assert_int_equal(SSD1680_EMULATOR_PARTIAL_REFRESH, s->last_refresh);
+  assert_int_equal(1, s->resets);  // woken from deep sleep
+  assert_int_equal(0, s->stray_bytes);
+  assert_int_equal(6, s->ram_bytes);
+  assert_true(ssd1680_emulator_spi_bytes() <= PARTIAL_LINE_BUDGET);
+
+  ssd1680_emulator_ascii(ascii, 10, 16, 12, 8);
+  assert_buff_equal(
+      "#########...\n"
+      ".#.....#....\n"
+      ".#.....#....\n"
+      ".#.....#....\n"
+      ".#.....#....\n"
+      ".#.....#....\n"
+      ".#.....#....\n"
+      ".#.....#....\n",
+      ascii,
+      strlen(ascii) + 1);
+  // the panel matches the RAM
+  for (uint16_t column = 10; column < 22; ++column) {
+    assert_int_equal(
+        ssd1680_emulator_pixel(0, column, 23),
+        ssd1680_emulator_panel_pixel(column, 23));
+  }
+}
+
+void test_partial_compare(void) {
+  struct OLEDM display;
+  struct Text text;
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  render_cold_frame(&display, "+++");
+
+  // Writing the same pixels to both RAMs means nothing changed as far as
+  // the controller can tell, thus the panel keeps showing the old frame.
+  epaper_start_partial(&display);
+  text_init(&text, &font, &display);
+  display.option_bits |= OLEDM_WRITE_COLOR_RAM;
+  text.column = 14;
+  text.row = 2;
+  text_str(&text, "-");
+  display.option_bits &= ~OLEDM_WRITE_COLOR_RAM;
+  text.column = 14;
+  text.row = 2;
+  text_str(&text, "-");
+  epaper_update_partial(&display, SLEEP_MODE_1);
+  assert_int_equal(0, display.error);
+  assert_int_equal(0, ssd1680_emulator_pixel(0, 14, 17));
+  assert_int_equal(1, ssd1680_emulator_panel_pixel(14, 17));
+
+  // A change is driven and then becomes the previous frame
+  epaper_start_partial(&display);
+  text.column = 10;
+  text.row = 2;
+  text_str(&text, "-");
+  epaper_update_partial(&display, SLEEP_MODE_1);
+  assert_int_equal(0, ssd1680_emulator_panel_pixel(11, 17));
+  assert_int_equal(1, ssd1680_emulator_panel_pixel(14, 17));
+  for (uint8_t y = 0; y < 128; ++y) {
+    for (uint16_t column = 0; column < SSD1680_EMULATOR_COLUMNS; ++column) {
+      assert_int_equal(
+          ssd1680_emulator_pixel(0, column, y),
+          ssd1680_emulator_pixel(1, column, y));
+    }
+  }
+}
+
+void test_graph(void) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  oledm_start(&display);
+  oledm_clear(&display, 0x00);
+  ssd1680_emulator_reset_stats();
+
+  uint8_t data[150];
+  for (uint8_t i = 0; i < sizeof(data); ++i) {
+    data[i] = i < 75 ? i / 5 : 29 - (i / 5);
+  }
+  graph_display_init(&gd, &display, sizeof(data), 4, data);
+  graph_display_render(&gd, 0, 12);
+  assert_int_equal(0, display.error);
+
+  const struct SSD1680EmulatorStats* s = &ssd1680_emulator_stats;
+  assert_int_equal(600, s->ram_bytes);
+  assert_int_equal(0, s->stray_bytes);
+  assert_true(ssd1680_emulator_spi_bytes() <= GRAPH_BUDGET);
+
+  // The left end climbs one pixel every 5 columns from the bottom
+  ssd1680_emulator_ascii(ascii, 0, 121, 12, 7);
+  assert_buff_equal(
+      "............\n"
+      "............\n"
+      "............\n"
+      "............\n"
+      "..........##\n"
+      ".....#####..\n"
+      "#####.......\n",
+      ascii,
+      strlen(ascii) + 1);
+  // and the peak is flat for 10 columns
+  ssd1680_emulator_ascii(ascii, 68, 112, 14, 3);
+  assert_buff_equal(
+      "..............\n"
+      "..##########..\n"
+      "##..........##\n",
+      ascii,
+      strlen(ascii) + 1);
+}
+
+// graph_display_render_columns() draws the same pixels as
+// graph_display_render() in one pass down the columns
+void test_graph_columns(void) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+  uint8_t data[150];
+  for (uint8_t i = 0; i < sizeof(data); ++i) {
+    data[i] = (i * 7) % 48;
+  }
+  static uint8_t expected[150][48];
+
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  oledm_start(&display);
+  oledm_clear(&display, 0x00);
+  graph_display_init(&gd, &display, sizeof(data), 6, data);
+  gd.column_offset = 17;
+  graph_display_render(&gd, 3, 10);
+  assert_int_equal(0, display.error);
+  for (uint8_t column = 0; column < 150; ++column) {
+    for (uint8_t y = 0; y < 48; ++y) {
+      expected[column][y] = ssd1680_emulator_pixel(0, column + 3, 80 + y);
+    }
+  }
+
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  oledm_start(&display);
+  oledm_clear(&display, 0x00);
+  ssd1680_emulator_reset_stats();
+  graph_display_render_columns(&gd, 3, 10);
+  assert_int_equal(0, display.error);
+
+  const struct SSD1680EmulatorStats* s = &ssd1680_emulator_stats;
+  assert_int_equal(900, s->ram_bytes);
+  assert_int_equal(0, s->stray_bytes);
+  for (uint8_t column = 0; column < 150; ++column) {
+    for (uint8_t y = 0; y < 48; ++y) {
+      assert_int_equal(
+          expected[column][y], ssd1680_emulator_pixel(0, column + 3, 80 + y));
+    }
+  }
+  // and nothing outside of the graph
+  for (uint8_t y = 0; y < 128; ++y) {
+    assert_int_equal(0, ssd1680_emulator_pixel(0, 2, y));
+    assert_int_equal(0, ssd1680_emulator_pixel(0, 153, y));
+  }
+
+  // Text after the graph goes back to filling rows
+  struct Text text;
+  text_init(&text, &font, &display);
+  text.column = 200;
+  text.row = 2;
+  text_str(&text, "+");
+  assert_int_equal(0, display.error);
+  ssd1680_emulator_ascii(ascii, 200, 16, 3, 2);
+  assert_buff_equal("###\n.#.\n", ascii, strlen(ascii) + 1);
+}
+
+// Data for the graph mode goldens: a dip and a recovery, with a noisy
+// stretch in the middle that the line does not show
+static const uint8_t mode_data[12] = {12, 11, 9, 6, 4, 3, 3, 5, 8, 10, 11, 11};
+static const struct GraphRange mode_ranges[12] = {
+  {12, 12}, {10, 12}, {8, 10}, {5, 7}, {2, 7}, {0, 6},
+  {1, 7}, {4, 6}, {7, 9}, {10, 10}, {10, 12}, {11, 11},
+};
+
+static struct GraphRange mode_range(column_t column) {
+  return mode_ranges[column];
+}
+
+// Draws the mode graph both ways and checks that they match.  The BW RAM
+// is left as drawn by graph_display_render_columns().
+static void render_mode(uint8_t mode) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+  char expected[1024];
+
+  ssd1680_emulator_reset();
+  oledm_basic_init(&display);
+  oledm_start(&display);
+  oledm_clear(&display, 0x00);
+  graph_display_init(&gd, &display, 12, 2, (uint8_t*)mode_data);
+  gd.mode = mode;
+  gd.range_callback = mode_range;
+  graph_display_render(&gd, 20, 4);
+  assert_int_equal(0, display.error);
+  ssd1680_emulator_ascii(expected, 20, 32, 12, 16);
+
+  oledm_clear(&display, 0x00);
+  graph_display_render_columns(&gd, 20, 4);
+  assert_int_equal(0, display.error);
+  ssd1680_emulator_ascii(ascii, 20, 32, 12, 16);
+  assert_buff_equal(expected, ascii, strlen(expected) + 1);
+}
+
+void test_graph_modes(void) {
+  render_mode(GRAPH_DISPLAY_LINE);
+  assert_buff_equal(
+      "............\n"
+      "............\n"
+      "............\n"
+      "#...........\n"
+      ".#........##\n"
+      "..#......#..\n"
+      "..#......#..\n"
+      "...#....#...\n"
+      "...#....#...\n"
+      "...#....#...\n"
+      "....#..#....\n"
+      "....#..#....\n"
+      ".....##.....\n"
+      "............\n"
+      "............\n"
+      "............\n",
+      ascii,
+      strlen(ascii) + 1);
+
+  // the swings around the bottom of the dip show up
+  render_mode(GRAPH_DISPLAY_ENVELOPE);
+  assert_buff_equal(
+      "............\n"
+      "............\n"
+      "............\n"
+      "##........#.\n"
+      ".#........##\n"
+      ".##......##.\n"
+      "..#.....#...\n"
+      "..#.....#...\n"
+      "...##.#.#...\n"
+      "...#####....\n"
+      "...#####....\n"
+      "....####....\n"
+      "....###.....\n"
+      "....###.....\n"
+      ".....##.....\n"
+      ".....#......\n",
+      ascii,
+      strlen(ascii) + 1);
+
+  render_mode(GRAPH_DISPLAY_FILLED);
+  assert_buff_equal(
+      "............\n"
+      "............\n"
+      "............\n"
+      "#...........\n"
+      "##........##\n"
+      "###......###\n"
+      "###......###\n"
+      "####....####\n"
+      "####....####\n"
+      "####....####\n"
+      "#####..#####\n"
+      "#####..#####\n"
+      "############\n"
+      "############\n"
+      "############\n"
+      "############\n",
+      ascii,
+      strlen(ascii) + 1);
+}
+
+int main(void) {
+  test(test_cold_frame);
+  test(test_dark_mode);
+  test(test_reversed_font);
+  test(test_partial_line);
+  test(test_partial_compare);
+  test(test_graph);
+  test(test_graph_columns);
+  test(test_graph_modes);
+  return 0;
+}
@@ -1,6 +1,7 @@
 #define SSD1680
 #include "epaper.h"
 #include <twi/twi_fake.h>
+#include <avr/io.h>
 
 #include <test/unit_test.h>
 
@@ -132,6 +133,65 @@ void test_start(void) {
   assert_buff_equal(expected_data, twi_log, sizeof(expected_data));
 }
 
+void test_start_partial(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  twi_log_reset();
+
+  epaper_start_partial(&display);
+  assert_int_equal(0, display.error);
+  assert_reg_activity(PIND);
+  assert_reg_activity(PORTB);
+
+  // Same as test_start but without the SW reset and using the partial LUT.
+  uint8_t expected_data[] = {
+    TWI_INIT,
+
+    TWI_START_WRITE, 0x3C,    // driver output
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x01,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x27,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x01,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x00,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,    // data entry mode
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x11,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x06,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,    // display update control 1
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x21,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x88,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_STOP,
+  };
+  assert_buff_equal(expected_data, twi_log, sizeof(expected_data));
+
+  // The RAM window is left for later so the partial LUT follows
+  uint8_t expected_lut[] = {
+    TWI_START_WRITE, 0x3C,   // set lut
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x32,
+    TWI_WRITE_NO_STOP, 0x80, // a couple of bytes from WF_PARTIAL_2IN9
+    TWI_WRITE_NO_STOP, 0x00,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x40,
+  };
+  assert_buff_equal(
+      expected_lut,
+      twi_log + sizeof(expected_data),
+      sizeof(expected_lut));
+}
+
 void test_epaper_set_full_mode(void) {
   struct OLEDM display;
   oledm_basic_init(&display);
@@ -158,6 +218,60 @@ void test_epaper_set_full_mode(void) {
   assert_buff_equal(expected_data, twi_log, sizeof(expected_data));
 }
 
+void test_epaper_set_temperature(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  assert_int_equal(EPAPER_NO_TEMPERATURE, display.epaper_temperature);
+  epaper_set_temperature(&display, -5);
+  twi_log_reset();
+
+  epaper_set_full_mode(&display);
+  assert_int_equal(0, display.error);
+
+  uint8_t expected_data[] = {
+    TWI_START_WRITE, 0x3C,   // temperature register
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x1A,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0xFB,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x00,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,   // load the OTP waveform
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x22,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x91,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x20,
+    TWI_STOP,
+  };
+  assert_buff_equal(expected_data, twi_log, sizeof(expected_data));
+  assert_int_equal(sizeof(expected_data), twi_logidx);
+
+  // Already loaded for this temperature
+  twi_log_reset();
+  epaper_set_temperature(&display, -5);
+  epaper_set_full_mode(&display);
+  assert_int_equal(0, twi_logidx);
+
+  // A new temperature reloads
+  epaper_set_temperature(&display, 21);
+  epaper_set_full_mode(&display);
+  assert_int_equal(sizeof(expected_data), twi_logidx);
+  assert_int_equal(21, twi_log[9]);
+
+  // Back to the host waveform
+  twi_log_reset();
+  epaper_set_temperature(&display, EPAPER_NO_TEMPERATURE);
+  epaper_set_full_mode(&display);
+  assert_int_equal(0x32, twi_log[5]);
+}
+
 void test_epaper_set_partial_mode(void) {
   struct OLEDM display;
   oledm_basic_init(&display);
@@ -191,7 +305,6 @@ void test_set_memory_bounds(void) {
 
   oledm_set_memory_bounds(&display, 258, 1, 290, 3);
   assert_int_equal(0, display.error);
-  assert_reg_activity(PIND);  // wait_until_idle()
   assert_reg_activity(PORTB);  // command_data()
 
   uint8_t expected_data[] = {
@@ -248,7 +361,6 @@ void test_set_memory_bounds_rotated(void) {
 
   oledm_set_memory_bounds(&display, 258, 1, 290, 3);
   assert_int_equal(0, display.error);
-  assert_reg_activity(PIND);  // wait_until_idle()
   assert_reg_activity(PORTB);  // command_data()
 
   uint8_t expected_data[] = {
@@ -337,6 +449,59 @@ void test_start_color_pixels(void) {
   assert_buff_equal(expected_data, twi_log, twi_logidx);
 }
 
+// OLEDM_COLUMN_MAJOR changes the data entry mode when pixels are started
+void test_column_major(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  display.epaper_state |= EPAPER_REGISTERS_SET;
+  display.epaper_registers = 0;
+  twi_log_reset();
+
+  display.option_bits |= OLEDM_COLUMN_MAJOR;
+  oledm_start_pixels(&display);
+  oledm_stop(&display);
+  display.option_bits &= ~OLEDM_COLUMN_MAJOR;
+  oledm_start_pixels(&display);
+  oledm_stop(&display);
+  // already set up
+  oledm_start_pixels(&display);
+  oledm_stop(&display);
+  assert_int_equal(0, display.error);
+
+  uint8_t expected_data[] = {
+    TWI_START_WRITE, 0x3C,    // data entry mode: x (rows) first
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x11,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x02,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,    // write ram BW
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x24,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,    // data entry mode: back to y (columns) first
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x11,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x06,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,    // write ram BW
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x24,
+    TWI_STOP,
+
+    TWI_START_WRITE, 0x3C,    // write ram BW
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x24,
+    TWI_STOP,
+  };
+  assert_int_equal(sizeof(expected_data), twi_logidx);
+  assert_buff_equal(expected_data, twi_log, twi_logidx);
+}
+
 void test_clear(void) {
   struct OLEDM display;
   oledm_basic_init(&display);
@@ -344,7 +509,6 @@ void test_clear(void) {
 
   oledm_clear(&display, 0x98);
   assert_int_equal(0, display.error);
-  assert_reg_activity(PIND);  // wait_until_idle()
   assert_reg_activity(PORTB);  // command_data()
 
   uint8_t expected_data[] = {
@@ -402,6 +566,41 @@ void test_clear(void) {
   assert_buff_equal(expected_data, twi_log, sizeof(expected_data));
 }
 
+void test_clear_auto_write(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  twi_log_reset();
+
+  oledm_clear(&display, 0xFF);
+  assert_int_equal(0, display.error);
+
+  // memory bounds (same as test_clear) then a single auto write
+  uint8_t expected_data[] = {
+    TWI_START_WRITE, 0x3C,    // auto write BW RAM
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x47,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0xF7,
+    TWI_STOP,
+  };
+  assert_int_equal(64 + sizeof(expected_data), twi_logidx);
+  assert_buff_equal(expected_data, twi_log + 64, sizeof(expected_data));
+
+  twi_log_reset();
+  epaper_clear_color_ram(&display, 0x00);
+  uint8_t expected_color[] = {
+    TWI_START_WRITE, 0x3C,    // auto write RED RAM
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x46,
+    TWI_WRITE_NO_STOP, 0x80,
+    TWI_WRITE_NO_STOP, 0x77,
+    TWI_STOP,
+  };
+  // The window was set again since the auto write might have changed it.
+  assert_int_equal(64 + sizeof(expected_color), twi_logidx);
+  assert_buff_equal(expected_color, twi_log + 64, sizeof(expected_color));
+}
+
 void test_swap_buffers(void) {
   struct OLEDM display;
   oledm_basic_init(&display);
@@ -488,6 +687,133 @@ void test_sleep_mode(void) {
   assert_buff_equal(expected_data, twi_log, twi_logidx);
 }
 
+void test_ram_retained(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  twi_log_reset();
+  assert_int_equal(0, epaper_ram_is_retained(&display));
+
+  epaper_sleep_mode(&display, SLEEP_MODE_1);
+  assert_int_equal(1, epaper_ram_is_retained(&display));
+
+  // skipping sleep does not change anything
+  epaper_sleep_mode(&display, SLEEP_MODE_OFF);
+  assert_int_equal(1, epaper_ram_is_retained(&display));
+
+  display.error = NO_ACK_ERROR;
+  assert_int_equal(0, epaper_ram_is_retained(&display));
+  display.error = 0;
+
+  epaper_sleep_mode(&display, SLEEP_MODE_2);
+  assert_int_equal(0, epaper_ram_is_retained(&display));
+}
+
+// Counts the traffic in twi_log.  Command bytes (and their parameters) are
+// logged as 0x80 followed by the byte while pixel data is logged as-is.
+// Thus tests using this should not write 0x80 pixels.
+struct Traffic {
+  uint16_t commands;
+  uint16_t command_bytes;  // includes the commands themselves
+  uint16_t pixel_bytes;
+};
+
+static void count_traffic(struct Traffic* t) {
+  t->commands = 0;
+  t->command_bytes = 0;
+  t->pixel_bytes = 0;
+  for (uint16_t i=0; i < twi_logidx;) {
+    if (twi_log[i] == TWI_START_WRITE) {
+      ++t->commands;
+      i += 2;
+    } else if ((twi_log[i] == TWI_WRITE_NO_STOP) && (twi_log[i + 1] == 0x80)) {
+      ++t->command_bytes;
+      i += 4;
+    } else if (twi_log[i] == TWI_WRITE_NO_STOP) {
+      ++t->pixel_bytes;
+      i += 2;
+    } else {
+      ++i;
+    }
+  }
+}
+
+void test_wake_traffic(void) {
+  struct OLEDM display;
+  struct Traffic t;
+  oledm_basic_init(&display);
+
+  // Power up: SW reset, all registers and the full LUT
+  twi_log_reset();
+  oledm_start(&display);
+  count_traffic(&t);
+  assert_int_equal(0, display.error);
+  assert_int_equal(13, t.commands);
+  assert_int_equal(187, t.command_bytes);
+
+  // Waking from SLEEP_MODE_1 skips the SW reset and driver output
+  epaper_sleep_mode(&display, SLEEP_MODE_1);
+  twi_log_reset();
+  oledm_start(&display);
+  count_traffic(&t);
+  assert_int_equal(11, t.commands);
+  assert_int_equal(182, t.command_bytes);
+
+  // Same for a partial wake, which also leaves the RAM window alone
+  epaper_sleep_mode(&display, SLEEP_MODE_1);
+  twi_log_reset();
+  epaper_start_partial(&display);
+  count_traffic(&t);
+  assert_int_equal(7, t.commands);
+  assert_int_equal(175, t.command_bytes);
+
+  // Already awake with the partial LUT loaded
+  twi_log_reset();
+  epaper_set_partial_mode(&display);
+  count_traffic(&t);
+  assert_int_equal(2, t.commands);
+  assert_int_equal(3, t.command_bytes);
+
+  // Setting the same window twice is free
+  oledm_set_memory_bounds(&display, 10, 2, 20, 4);
+  twi_log_reset();
+  oledm_set_memory_bounds(&display, 10, 2, 20, 4);
+  count_traffic(&t);
+  assert_int_equal(0, t.commands);
+  assert_int_equal(0, t.command_bytes);
+
+  // unless pixels were written, then the pointer needs to go back
+  oledm_start_pixels(&display);
+  oledm_stop(&display);
+  twi_log_reset();
+  oledm_set_memory_bounds(&display, 10, 2, 20, 4);
+  count_traffic(&t);
+  assert_int_equal(2, t.commands);
+  assert_int_equal(5, t.command_bytes);
+}
+
+// Renders a line of 10 12x3 characters, the way text.c does
+void test_text_line_traffic(void) {
+  struct OLEDM display;
+  struct Traffic t;
+  oledm_basic_init(&display);
+  twi_log_reset();
+
+  for (column_t column = 0; column < 120; column += 12) {
+    oledm_set_bounds(&display, column, 4, column + 11, 6);
+    oledm_start_pixels(&display);
+    for (uint8_t i = 0; i < 36; ++i) {
+      oledm_write_pixels(&display, 0x0F);
+    }
+    oledm_stop(&display);
+  }
+  count_traffic(&t);
+  // The rows only need to be sent once, then each character is new
+  // columns, a pointer and the pixels.
+  assert_int_equal(1 + 10 * 4, t.commands);
+  assert_int_equal(3 + 10 * (5 + 5 + 1), t.command_bytes);
+  assert_int_equal(10 * 36, t.pixel_bytes);
+}
+
 void test_reset(void) {
   epaper_reset();
   assert_history(PORTB, 0x00, 0x01);
@@ -501,21 +827,117 @@ void test_epaper_wait(void) {
   assert_reg_activity(PIND);
 }
 
+static uint8_t sleep_calls;
+static uint8_t sleeps_until_idle;
+static uint8_t fake_time;
+
+// Pretends that the display is done after a few sleeps
+static void fake_sleep(void) {
+  ++sleep_calls;
+  if (sleep_calls >= sleeps_until_idle) {
+    PIND &= ~(1 << 7);
+  }
+}
+
+static uint8_t fake_seconds(void) {
+  return fake_time;
+}
+
+// Every call is a second later
+static uint8_t fake_seconds_fast(void) {
+  return fake_time++;
+}
+
+void test_epaper_wait_sleep(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  sleep_calls = 0;
+  sleeps_until_idle = 3;
+  fake_time = 0;
+  epaper_set_busy_sleep(fake_sleep, fake_seconds);
+
+  PCICR = 0;
+  PIND |= (1 << 7);
+  epaper_wait(&display);
+  assert_int_equal(0, display.error);
+  assert_int_equal(3, sleep_calls);
+  // The pin change interrupt is only enabled while waiting
+  assert_int_equal(0, PCICR & (1 << 2));
+  assert_int_equal(0, PCMSK2 & (1 << 7));
+
+  // Pin change settings that were already there are left alone
+  sleep_calls = 0;
+  PCICR = 1 << 2;
+  PCMSK2 = (1 << 7) | (1 << 6);
+  PIND |= (1 << 7);
+  epaper_wait(&display);
+  assert_int_equal(3, sleep_calls);
+  assert_int_equal(1 << 2, PCICR);
+  assert_int_equal((1 << 7) | (1 << 6), PCMSK2);
+  PCICR = 0;
+  PCMSK2 = 0;
+
+  // The seconds counter wrapping is not a timeout
+  sleep_calls = 0;
+  fake_time = 0xFE;
+  epaper_set_busy_sleep(fake_sleep, fake_seconds_fast);
+  PIND |= (1 << 7);
+  epaper_wait(&display);
+  assert_int_equal(0, display.error);
+  assert_int_equal(3, sleep_calls);
+  epaper_set_busy_sleep(fake_sleep, fake_seconds);
+
+  // Not busy at all
+  sleep_calls = 0;
+  epaper_wait(&display);
+  assert_int_equal(0, display.error);
+  assert_int_equal(0, sleep_calls);
+
+  epaper_set_busy_sleep(0, 0);
+}
+
+void test_epaper_wait_sleep_timeout(void) {
+  struct OLEDM display;
+  oledm_basic_init(&display);
+  sleep_calls = 0;
+  sleeps_until_idle = 0xFF;
+  fake_time = 0;
+  epaper_set_busy_sleep(fake_sleep, fake_seconds_fast);
+
+  PIND |= (1 << 7);
+  epaper_wait(&display);
+  assert_int_equal(NO_ACK_ERROR, display.error);
+  assert_int_equal(4, sleep_calls);
+  assert_int_equal(0, PCMSK2 & (1 << 7));
+
+  PIND &= ~(1 << 7);
+  epaper_set_busy_sleep(0, 0);
+}
+
 int main(void) {
   test(test_basic_init);
   test(test_start);
+  test(test_start_partial);
   test(test_epaper_set_full_mode);
+  test(test_epaper_set_temperature);
   test(test_epaper_set_partial_mode);
   test(test_set_memory_bounds);
   test(test_set_memory_bounds_rotated);
   test(test_output_pixels);
   test(test_start_color_pixels);
+  test(test_column_major);
   test(test_clear);
+  test(test_clear_auto_write);
   test(test_swap_buffers);
   test(test_update_partial);
   test(test_sleep_mode);
+  test(test_ram_retained);
+  test(test_wake_traffic);
+  test(test_text_line_traffic);
   test(test_reset);
   test(test_epaper_wait);
+  test(test_epaper_wait_sleep);
+  test(test_epaper_wait_sleep_timeout);
 
   return 0;
 }
@@ -1,5 +1,6 @@
 #include "text.h"
 
+#include "band.h"
 #include "oledm.h"
 #include <avr/pgmspace.h>
 #include <string.h>
@@ -10,75 +11,178 @@ struct RLETracker {
   const uint8_t* pgm_data;  // address of next byte
   uint8_t bytes_remaining;  // number of bytes remaining on the current run
   bool_t repeat_mode;  // if true, then we are in repeat mode
+  // Bytes left in a VAR2 replay, and where the data continues after it
+  uint8_t replay_remaining;
+  const uint8_t* replay_return;
 };
 
+static void start_rle(struct RLETracker* self, const uint8_t* pgm_data) {
+  self->pgm_data = pgm_data;
+  self->bytes_remaining = 0;
+  self->replay_remaining = 0;
+}
+
+// Reads the header of the next sequence.  Returns false (and sets err) if
+// the data is invalid.
+static bool_t start_rle_sequence(struct RLETracker* self, error_t* err) {
+  uint8_t header = pgm_read_byte_near(self->pgm_data);
+  if ((header == 0) && !self->replay_remaining) {
+    // VAR2 replay of earlier sequences
+    self->replay_remaining = pgm_read_byte_near(self->pgm_data + 1);
+    if (self->replay_remaining == 0) {
+      *err = TEXT_INVALID_RLE_DATA;
+      return 0;
+    }
+    self->replay_return = self->pgm_data + 4;
+    self->pgm_data -=
+      (((uint16_t)pgm_read_byte_near(self->pgm_data + 2)) << 8) |
+      pgm_read_byte_near(self->pgm_data + 3);
+    header = pgm_read_byte_near(self->pgm_data);
+  }
+  ++self->pgm_data;
+  if (header & 0x80) {
+    header &= 0x7F;
+    self->repeat_mode = 0;
+  } else {
+    self->repeat_mode = 1;
+  }
+
+  if (header == 0) {
+    // data is invalid
+    *err = TEXT_INVALID_RLE_DATA;
+    return 0;
+  }
+  if (self->replay_remaining && (header > self->replay_remaining)) {
+    // the replay ends part way into this sequence
+    header = self->replay_remaining;
+  }
+  self->bytes_remaining = header;
+  return 1;
+}
+
+// Moves past length bytes of the current sequence
+static void skip_rle_bytes(struct RLETracker* self, uint8_t length) {
+  self->bytes_remaining -= length;
+  if (!self->repeat_mode) {
+    self->pgm_data += length;
+  } else if (self->bytes_remaining == 0) {
+    ++self->pgm_data;
+  }
+  if (self->replay_remaining) {
+    self->replay_remaining -= length;
+    if (self->replay_remaining == 0) {
+      self->pgm_data = self->replay_return;
+      self->bytes_remaining = 0;
+    }
+  }
+}
+
 static uint8_t next_rle_byte(struct RLETracker* self, error_t* err) {
   if (*err) {
     return 0xFF;
   }
-  if (self->bytes_remaining == 0) {
-    // prep for the next sequence
-    self->bytes_remaining = pgm_read_byte_near(self->pgm_data);
-    ++self->pgm_data;
-    if (self->bytes_remaining & 0x80) {
-      self->bytes_remaining &= 0x7F;
-      self->repeat_mode = 0;
-    } else {
-      self->repeat_mode = 1;
-    }
+  if ((self->bytes_remaining == 0) && !start_rle_sequence(self, err)) {
+    return 0xFF;
+  }
 
-    if (self->bytes_remaining == 0) {
-      // data is invalid
-      *err = TEXT_INVALID_RLE_DATA;
-      return 0xFF;
+  const uint8_t b = pgm_read_byte_near(self->pgm_data);
+  skip_rle_bytes(self, 1);
+  return b;
+}
+
+// Repeated bytes that have not been sent yet.  Neighboring sequences (and
+// glyphs) often repeat the same byte, so these are joined before they go
+// to oledm_write_pixel_run().
+struct PixelRun {
+  uint8_t pixels;
+  uint16_t length;
+  bool_t reversed;  // the font has VARIABLE_FONT_REVERSED
+};
+
+static void flush_run(struct OLEDM* display, struct PixelRun* run) {
+  if (run->length) {
+    if (run->reversed) {
+      oledm_write_reversed_run(display, run->pixels, run->length);
+    } else {
+      oledm_write_pixel_run(display, run->pixels, run->length);
     }
+    run->length = 0;
   }
+}
 
-  const uint8_t b = pgm_read_byte_near(self->pgm_data);
-  --self->bytes_remaining;
-  if (!self->repeat_mode || (self->bytes_remaining == 0)) {
-    ++self->pgm_data;
+static void add_run(
+    struct OLEDM* display, struct PixelRun* run, uint8_t pixels, uint8_t length) {
+  if (run->pixels != pixels) {
+    flush_run(display, run);
+    run->pixels = pixels;
   }
-  return b;
+  run->length += length;
 }
 
-void text_verifyFont(struct Text* text) {
-  if (text->display->error) {
+// Sends the next count bytes of RLE data a whole sequence at a time.  Only
+// the first visible bytes are sent, the rest are skipped over.
+static void write_rle_bytes(
+    struct OLEDM* display,
+    struct RLETracker* self,
+    uint8_t count,
+    uint8_t visible,
+    uint8_t invert,
+    struct PixelRun* run) {
+  if (display->error) {
     return;
   }
-  const struct VariableFont* font = (struct VariableFont*)text->font;
-  const uint8_t* id = font->id;
-  if ((pgm_read_byte_near(id) != 'V') ||
-      (pgm_read_byte_near(id + 1) != 'A') || 
-      (pgm_read_byte_near(id + 2) != 'R') ||
-      (pgm_read_byte_near(id + 3) != '1')) {
-    text->display->error = SSD1306_BAD_FONT_ID_ERROR;
+  while (count) {
+    if ((self->bytes_remaining == 0) &&
+        !start_rle_sequence(self, &display->error)) {
+      return;
+    }
+    const uint8_t length =
+      count < self->bytes_remaining ? count : self->bytes_remaining;
+    const uint8_t shown = visible < length ? visible : length;
+
+    if (self->repeat_mode) {
+      if (shown) {
+        add_run(display, run, pgm_read_byte_near(self->pgm_data) ^ invert, shown);
+      }
+    } else {
+      if (invert) {
+        for (uint8_t i = 0; i < shown; ++i) {
+          add_run(display, run, pgm_read_byte_near(self->pgm_data + i) ^ invert, 1);
+        }
+      } else if (shown) {
+        flush_run(display, run);
+        if (run->reversed) {
+          oledm_write_reversed_buf(display, self->pgm_data, shown, 1);
+        } else {
+          oledm_write_pixel_buf(display, self->pgm_data, shown, 1);
+        }
+      }
+    }
+    skip_rle_bytes(self, length);
+
+    count -= length;
+    visible -= shown;
   }
 }
 
-static const uint8_t* find_character_data(
-    const struct VariableFont* font,
-    const char c,
-    uint8_t* width) {
+// Binary search of the character table.  Returns the table index of the
+// last character <= c.
+static uint8_t search_table(const struct VariableFont* font, const char c) {
   const uint8_t num_chars = pgm_read_byte_near(&font->num_chars);
 
-  // binary search
   uint8_t mask = 0x80;
   while (mask > num_chars) {
     mask >>= 1;
   }
 
   uint8_t search_idx = 0;
-  char slot_c = 0;
-  const uint8_t* pgm_slot_addr = 0;
   for (; mask; mask >>= 1) {
     search_idx |= mask;
     if (search_idx >= num_chars) {
       // too high
       search_idx &= ~mask;
     } else {
-      pgm_slot_addr = font->data + (search_idx << 2);
-      slot_c = pgm_read_byte_near(pgm_slot_addr);
+      const char slot_c = pgm_read_byte_near(font->data + (search_idx << 2));
       if (slot_c > c) {
         // overshot the mark
         search_idx &= ~mask;
@@ -86,54 +190,123 @@ static const uint8_t* find_character_data(
     }
   }
 
-  pgm_slot_addr = font->data + (search_idx << 2);
-  slot_c = pgm_read_byte_near(pgm_slot_addr);
-
-  if (c == slot_c) {
-    // found it
-    *width = pgm_read_byte_near(pgm_slot_addr + 1);
-    const uint16_t offset =
-      (((uint16_t)pgm_read_byte_near(pgm_slot_addr + 2)) << 8) |
-      pgm_read_byte_near(pgm_slot_addr + 3);
-    return font->data + offset;
-  }
-
-  // did not find anything
-  return 0;
+  return search_idx;
 }
 
-static void render_char(
-    struct Text*  text,
-    const uint8_t height,
-    const char c) {
-  if (text->column >= text->display->memory_columns) {
-    // off the right edge
+void text_verifyFont(struct Text* text) {
+  if (text->display->error || (text->font == text->verified_font)) {
     return;
   }
-
   const struct VariableFont* font = (struct VariableFont*)text->font;
+  const uint8_t* id = font->id;
+  if ((pgm_read_byte_near(id) != 'V') ||
+      (pgm_read_byte_near(id + 1) != 'A') || 
+      (pgm_read_byte_near(id + 2) != 'R') ||
+      ((pgm_read_byte_near(id + 3) != '1') &&
+       (pgm_read_byte_near(id + 3) != '2'))) {
+    text->display->error = SSD1306_BAD_FONT_ID_ERROR;
+    return;
+  }
 
-  uint8_t width = 0;
-  struct RLETracker rle_tracker;
-  rle_tracker.bytes_remaining = 0;
-  rle_tracker.pgm_data = find_character_data(font, c, &width);
+  text->dense_count = 0;
+  if ((pgm_read_byte_near(font->data) == 0) &&
+      (pgm_read_byte_near(font->data + 1) == 0)) {
+    // The font has a dense index.  Find where the range starts in the
+    // table and check that it really is contiguous.
+    const uint8_t first_char = pgm_read_byte_near(font->data + 2);
+    const uint8_t count = pgm_read_byte_near(font->data + 3);
+    const uint8_t index = search_table(font, first_char);
+    const uint8_t last = index + count - 1;
+    if ((count == 0) ||
+        (last >= pgm_read_byte_near(&font->num_chars)) ||
+        (pgm_read_byte_near(font->data + (index << 2)) != first_char) ||
+        (pgm_read_byte_near(font->data + (last << 2)) !=
+          (uint8_t)(first_char + count - 1))) {
+      text->display->error = TEXT_BAD_FONT_INDEX_ERROR;
+      return;
+    }
+    text->dense_first_char = first_char;
+    text->dense_count = count;
+    text->dense_index = index;
+  }
 
-  if (!rle_tracker.pgm_data) {
-    // Character not found
-    return;
+  text->verified_font = text->font;
+}
+
+// Returns the RLE data for c and its width, or 0 if the font does not have
+// it.  text_verifyFont() must have been called first.
+static const uint8_t* find_character_data(
+    const struct Text* text,
+    const char c,
+    uint8_t* width) {
+  const struct VariableFont* font = (struct VariableFont*)text->font;
+  const uint8_t dense_offset = (uint8_t)c - text->dense_first_char;
+  const uint8_t* pgm_slot_addr;
+  if (dense_offset < text->dense_count) {
+    // no need to search
+    pgm_slot_addr = font->data + ((text->dense_index + dense_offset) << 2);
+  } else {
+    pgm_slot_addr = font->data + (search_table(font, c) << 2);
+    if (c != (char)pgm_read_byte_near(pgm_slot_addr)) {
+      // did not find anything
+      return 0;
+    }
   }
 
-  // setup boundaries for this character
-  column_t max_column = text->column + width;
-  if (max_column > text->display->memory_columns) {
-    max_column = text->display->memory_columns;
+  *width = pgm_read_byte_near(pgm_slot_addr + 1);
+  if (*width == 0) {
+    // the dense index entry
+    return 0;
   }
+  const uint16_t offset =
+    (((uint16_t)pgm_read_byte_near(pgm_slot_addr + 2)) << 8) |
+    pgm_read_byte_near(pgm_slot_addr + 3);
+  return font->data + offset;
+}
 
-  uint8_t max_row = text->row + height;
-  if (max_row > text->display->memory_rows) {
-    max_row = text->display->memory_rows;
+// Number of characters that text_strLen() can send in one window.  Each one
+// costs a struct Glyph on the stack.
+#ifndef TEXT_WINDOW_CHARS
+#define TEXT_WINDOW_CHARS 8
+#endif
+
+struct Glyph {
+  struct RLETracker rle_tracker;
+  uint8_t width;
+};
+
+// Returns true if all count bytes of the RLE data are 0x00.  Invalid data
+// is not blank so that it gets rendered (and reported) as usual.
+static bool_t is_blank(const uint8_t* pgm_data, uint16_t count) {
+  struct RLETracker tracker;
+  error_t err = 0;
+  start_rle(&tracker, pgm_data);
+  while (count) {
+    if (!start_rle_sequence(&tracker, &err)) {
+      return 0;
+    }
+    const uint8_t length = tracker.bytes_remaining;
+    const uint8_t stored = tracker.repeat_mode ? 1 : length;
+    for (uint8_t i = 0; i < stored; ++i) {
+      if (pgm_read_byte_near(tracker.pgm_data + i)) {
+        return 0;
+      }
+    }
+    skip_rle_bytes(&tracker, length);
+    count = count > length ? count - length : 0;
   }
+  return 1;
+}
 
+// Sends the glyphs in a single window that starts at text->column and ends
+// before max_column.  The window is filled a row at a time so each glyph
+// keeps its own place in the RLE data.
+static void render_glyphs(
+    struct Text* text,
+    struct Glyph* glyphs,
+    uint8_t num_glyphs,
+    column_t max_column,
+    uint8_t max_row) {
   // lower-right is inclusive
   oledm_set_bounds(
       text->display,
@@ -144,20 +317,27 @@ static void render_char(
 
   oledm_start_pixels(text->display);
 
-  const uint8_t normal = ((text->options & TEXT_OPTION_INVERTED) == 0);
+  const uint8_t invert = (text->options & TEXT_OPTION_INVERTED) ? 0xFF : 0x00;
+  const struct VariableFont* font = (struct VariableFont*)text->font;
+  struct PixelRun run = {
+    0x00, 0, pgm_read_byte_near(&font->height) & VARIABLE_FONT_REVERSED};
   for (uint8_t row = text->row; row < max_row; ++row) {
-    for (uint8_t x = 0; x < width; ++x) {
-      // always read the next byte
-      const uint8_t data_byte = next_rle_byte(&rle_tracker, &text->display->error);
-      // only send it if it's within bounds
-      if ((text->column + x) < max_column) {
-        oledm_write_pixels(text->display, normal ? data_byte : (data_byte ^ 0xFF));
+    column_t column = text->column;
+    for (uint8_t i = 0; i < num_glyphs; ++i) {
+      struct Glyph* g = glyphs + i;
+      // always read the whole glyph row, but only send what is in bounds
+      uint8_t visible = 0;
+      if (column < max_column) {
+        visible = max_column - column < g->width ? max_column - column : g->width;
       }
+      write_rle_bytes(
+          text->display, &g->rle_tracker, g->width, visible, invert, &run);
+      column += g->width;
     }
   }
+  flush_run(text->display, &run);
 
   oledm_stop(text->display);
-  text->column = max_column;
 }
 
 void text_strLen(struct Text* text, const char* str, uint8_t len) {
@@ -172,15 +352,132 @@ void text_strLen(struct Text* text, const char* str, uint8_t len) {
     return;
   }
 
+  const uint8_t height = text_height(text);
+  uint8_t max_row = text->row + height;
+  if (max_row > memory_rows) {
+    max_row = memory_rows;
+  }
+  const column_t memory_columns = text->display->memory_columns;
+  // Blank glyphs on a cleared background would only send 0x00 bytes
+  const bool_t skip_blank =
+    (text->options & (TEXT_OPTION_CLEARED | TEXT_OPTION_INVERTED)) ==
+    TEXT_OPTION_CLEARED;
+
+  struct Glyph glyphs[TEXT_WINDOW_CHARS];
+  uint8_t i = 0;
+  while ((i < len) && (text->column < memory_columns)) {
+    // Measure as many characters as will go in one window
+    uint8_t num_glyphs = 0;
+    column_t max_column = text->column;
+    for (; (i < len) && (num_glyphs < TEXT_WINDOW_CHARS) &&
+        (max_column < memory_columns); ++i) {
+      struct Glyph* g = glyphs + num_glyphs;
+      start_rle(&g->rle_tracker, find_character_data(text, str[i], &g->width));
+      if (!g->rle_tracker.pgm_data) {
+        // Character not found
+        continue;
+      }
+      if (skip_blank &&
+          is_blank(g->rle_tracker.pgm_data, (uint16_t)g->width * height)) {
+        if (num_glyphs) {
+          // send what we have first
+          break;
+        }
+        // nothing to send, just move over
+        text->column += g->width;
+        max_column = text->column;
+        continue;
+      }
+      max_column += g->width;
+      ++num_glyphs;
+    }
+
+    if (max_column > memory_columns) {
+      max_column = memory_columns;
+    }
+    if (num_glyphs) {
+      render_glyphs(text, glyphs, num_glyphs, max_column, max_row);
+      if (text->display->error) {
+        return;
+      }
+    }
+    text->column = max_column;
+  }
+}
+
+uint8_t text_height(struct Text* text) {
   const struct VariableFont* font = (struct VariableFont*)text->font;
-  const uint8_t height = pgm_read_byte_near(&font->height);
+  return pgm_read_byte_near(&font->height) & VARIABLE_FONT_HEIGHT_MASK;
+}
+
+column_t text_measureLen(struct Text* text, const char* str, uint8_t len) {
+  text_verifyFont(text);
+  if (text->display->error) {
+    return 0;
+  }
 
-  // write the characters one at a time
+  column_t columns = 0;
   for (uint8_t i=0; i<len; ++i) {
-    render_char(text, height, str[i]);
+    uint8_t width = 0;
+    if (find_character_data(text, str[i], &width)) {
+      columns += width;
+    }
+  }
+  return columns;
+}
+
+void text_band_strLen(
+    struct Text* text, struct Band* band, const char* str, uint8_t len) {
+  text_verifyFont(text);
+  if ((len == 0) || (text->display->error)) {
+    return;
+  }
+
+  const struct VariableFont* font = (struct VariableFont*)text->font;
+  const uint8_t height_flags = pgm_read_byte_near(&font->height);
+  const uint8_t height = height_flags & VARIABLE_FONT_HEIGHT_MASK;
+  const bool_t reversed = height_flags & VARIABLE_FONT_REVERSED;
+  const uint8_t in_band =
+    (band->row >= text->row) && (band->row < (text->row + height));
+  const uint8_t invert = (text->options & TEXT_OPTION_INVERTED) ? 0xFF : 0x00;
+  const column_t memory_columns = text->display->memory_columns;
+
+  for (uint8_t i=0; (i < len) && (text->column < memory_columns); ++i) {
+    uint8_t width = 0;
+    struct RLETracker rle_tracker;
+    start_rle(&rle_tracker, find_character_data(text, str[i], &width));
+    if (!rle_tracker.pgm_data) {
+      continue;
+    }
+
+    if (in_band) {
+      // skip the rows above the band
+      uint16_t skip = (uint16_t)(band->row - text->row) * width;
+      for (; skip; --skip) {
+        next_rle_byte(&rle_tracker, &text->display->error);
+      }
+      for (uint8_t x = 0; x < width; ++x) {
+        uint8_t data_byte = next_rle_byte(&rle_tracker, &text->display->error);
+        if (reversed) {
+          // the band is in oledm bit order
+          data_byte = oledm_reverse_byte(data_byte);
+        }
+        band_put(band, text->column + x, data_byte ^ invert);
+      }
+    }
+
+    // same as text_strLen()
+    text->column += width;
+    if (text->column > memory_columns) {
+      text->column = memory_columns;
+    }
   }
 }
 
+void text_band_str(struct Text* text, struct Band* band, const char* str) {
+  text_band_strLen(text, band, str, strlen(str));
+}
+
 void text_clear_row(struct Text* text) {
   text_verifyFont(text);
 
@@ -202,8 +499,7 @@ void text_clear_row(struct Text* text) {
     return;
   }
 
-  const struct VariableFont* font = (struct VariableFont*)text->font;
-  const uint8_t font_height = pgm_read_byte_near(&font->height);
+  const uint8_t font_height = text_height(text);
   const column_t start_column = text->column;
   uint8_t max_row = text->row + font_height - 1;
   if (max_row > (memory_rows - 1)) {
@@ -218,12 +514,10 @@ void text_clear_row(struct Text* text) {
       max_row);
 
   oledm_start_pixels(text->display);
-  for (uint8_t row = text->row; row <= max_row; ++row) {
-    for (text->column = start_column;
-         text->column < memory_columns;
-         ++text->column) {
-        oledm_write_pixels(text->display, 0);
-    }
-  }
+  oledm_write_pixel_run(
+      text->display,
+      0,
+      (uint16_t)(max_row - text->row + 1) * (memory_columns - start_column));
   oledm_stop(text->display);
+  text->column = memory_columns;
 }
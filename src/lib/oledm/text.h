@@ -28,6 +28,10 @@
 
 // This is a bit field, 0x01, 0x02, 0x04, 0x08, 0x10...
 #define TEXT_OPTION_INVERTED 0x01
+// Set this when the area being drawn is known to be cleared to 0x00.  Blank
+// characters (such as spaces) then only move text->column and send nothing
+// to the display.
+#define TEXT_OPTION_CLEARED 0x02
 
 struct Text {
     const uint8_t* font;    // Pointer to some font data
@@ -35,6 +39,12 @@ struct Text {
     column_t column;           // Current column to start printing text from
     uint8_t row;              // Current row to start printing text from
     uint8_t options;          // Can add TEXT_OPTION_* flags here
+
+    // Set by text_verifyFont().  font is only checked again when it changes.
+    const uint8_t* verified_font;
+    uint8_t dense_first_char;  // see the dense index in struct VariableFont
+    uint8_t dense_count;
+    uint8_t dense_index;
 };
 
 struct FontASCII {
@@ -60,10 +70,17 @@ struct FontASCII {
   uint8_t data[];     
 };
 
+// Flags in the upper bits of VariableFont.height
+#define VARIABLE_FONT_HEIGHT_MASK 0x1F
+// Data bytes have the top pixel in bit 7 instead of bit 0, which is what
+// the SSD1680 wants.  See oledm_write_reversed_run()
+#define VARIABLE_FONT_REVERSED 0x80
+
 struct VariableFont {
-  uint8_t id[4];       // Should be set to 'VAR1'
+  uint8_t id[4];       // Should be set to 'VAR1', or 'VAR2' (see below)
   uint8_t num_chars;   // number of characters
   uint8_t height;      // row width of each character where a row is 8 pixels
+                       // plus VARIABLE_FONT_* flags
 
   // Now for a lookup table.  Format is
   // uint8_t char_idx
@@ -73,6 +90,15 @@ struct VariableFont {
   //
   // Where offset is the number of bytes from the start of data[]
   // char_idx must be in order to support binary search
+  //
+  // Optionally, the first entry can be a dense index instead of a character:
+  // 0x00, 0x00, first_char, count
+  //
+  // i.e. character 0 with a width of 0.  This says that first_char through
+  // first_char + count - 1 are all in the table, one after another.  Those
+  // characters are then found without a search.  num_chars includes this
+  // entry.  Since it sorts first, fonts with an index still work with a
+  // plain binary search.
 
   // then comes all of the data bytes.  These are stored in a simple
   // but effective RLE format of the following pattern:
@@ -87,6 +113,15 @@ struct VariableFont {
   //
   // The pattern is effective due to all of the whitespace and repeating
   // patterns in a typical font.  Think about 'H', '-', '.' etc...
+  //
+  // 'VAR2' fonts can also replay earlier data:
+  // 0x00, count, distance_hi, distance_lo
+  //
+  // This decodes to the next count bytes (1-255) of the sequences that
+  // start distance bytes before the 0x00.  Rows of a glyph often repeat the
+  // one above and glyphs share strokes, which plain RLE can not see.  The
+  // replayed sequences can not contain another replay.  A replay that ends
+  // part way into a sequence just drops the rest of it.
   uint8_t data[];     
 };
 
@@ -95,7 +130,8 @@ void text_init(struct Text* text, const void* font, struct OLEDM* display);
 
 // outputs a string.  text must be initialized with a fixed
 // font or this function will set an error in text->display
-// and do nothing.
+// and do nothing.  Neighboring characters are sent in a single window
+// (up to TEXT_WINDOW_CHARS at a time).
 void text_strLen(struct Text* text, const char* str, uint8_t length);
 void text_str(struct Text* text, const char* str);
 // Pascal string.  Useful in combination with the pstr/pstr.h library,
@@ -108,14 +144,33 @@ static inline void text_char(struct Text* text, char c) {
   text_strLen(text, &c, 1);
 }
 
+// Returns the height of the current font in rows
+uint8_t text_height(struct Text* text);
+
+// Returns the number of columns that text_strLen() or text_str() would move
+// text->column by, ignoring the right edge of the display.  Useful for right
+// aligning text.
+column_t text_measureLen(struct Text* text, const char* str, uint8_t length);
+column_t text_measure(struct Text* text, const char* str);
+
+// Band rendering versions of text_strLen() and text_str().  See band.h
+// These draw the part of the string that falls in band->row (if any) and
+// advance text->column the same way whether or not it does.  Thus the
+// caller needs to set text->column and text->row for every band.
+struct Band;
+void text_band_strLen(
+    struct Text* text, struct Band* band, const char* str, uint8_t length);
+void text_band_str(struct Text* text, struct Band* band, const char* str);
+
 // Clears from the current column to the end of the line.
 // Sets text->column to the maximum available column
 // The number of rows cleared is based on the height of the current font
 void text_clear_row(struct Text* text);
 
 
-// Verifies the given data has an expected id.  Sets text->display->error
-// if not
+// Verifies the given data has an expected id and a valid index.  Sets
+// text->display->error if not.  This is called by text_init() and again by
+// the text functions after text->font is changed.
 void text_verifyFont(struct Text* text);
 
 #endif  // SSD1360_TEXT_H
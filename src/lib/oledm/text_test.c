@@ -1,5 +1,6 @@
 #include "text.h"
 
+#include <string.h>
 #include <test/unit_test.h>
 
 // Directly include some deps to avoid making the test makefile more complex
@@ -71,6 +72,100 @@ static struct VariableFont font = {
     },
 };
 
+// A font with a blank character
+static struct VariableFont blank_font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 2,
+    .height = 1,
+    .data = {
+      ' ', 2, 0x00, 8,
+      '|', 1, 0x00, 10,
+
+      0x02, 0x00,
+      0x01, 0xFF
+    },
+};
+
+// The same as font but with VARIABLE_FONT_REVERSED
+static struct VariableFont reversed_font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 3,
+    .height = 2 | VARIABLE_FONT_REVERSED,
+    .data = {
+      '+', 3, 0x00, 12,
+      '-', 3, 0x00, 19,
+      '|', 1, 0x00, 23,
+      0x86, 0x80, 0xFF, 0x80, 0x00, 0xFF, 0x00,
+      0x03, 0x80, 0x03, 0x00,
+      0x02, 0xFF
+    },
+};
+
+// VAR2, with some characters made from replays of the others
+static struct VariableFont replay_font = {
+    .id = { 'V', 'A', 'R', '2' },
+    .num_chars = 6,
+    .height = 2,
+    .data = {
+      ' ', 3, 0x00, 45,
+      '!', 3, 0x00, 53,
+      '#', 3, 0x00, 37,
+      '+', 3, 0x00, 24,
+      '-', 3, 0x00, 31,
+      '|', 1, 0x00, 35,
+
+      // the same as font
+      0x86, 0x01, 0xFF, 0x01, 0x00, 0xFF, 0x00,
+      0x03, 0x01, 0x03, 0x00,
+      0x02, 0xFF,
+
+      // '#' is the top of '+' and the bottom of '-'
+      0x00, 3, 0x00, 13,
+      0x00, 3, 0x00, 8,
+
+      // ' ' is the bottom of '-' twice
+      0x00, 3, 0x00, 12,
+      0x00, 3, 0x00, 16,
+
+      // '!' replays the replay in '#', which is not allowed
+      0x00, 3, 0x00, 16,
+    },
+};
+
+// A font with a dense index for 'a'-'c'
+static struct VariableFont dense_font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 5,
+    .height = 1,
+    .data = {
+      0, 0, 'a', 3,
+      ' ', 1, 0x00, 20,
+      'a', 1, 0x00, 22,
+      'b', 1, 0x00, 24,
+      'c', 1, 0x00, 26,
+
+      0x01, 0x00,
+      0x01, 0x0A,
+      0x01, 0x0B,
+      0x01, 0x0C,
+    },
+};
+
+// The index says 'a'-'d' but there is no 'd'
+static struct VariableFont bad_index_font = {
+    .id = { 'V', 'A', 'R', '1' },
+    .num_chars = 3,
+    .height = 1,
+    .data = {
+      0, 0, 'a', 4,
+      'a', 1, 0x00, 12,
+      'b', 1, 0x00, 14,
+
+      0x01, 0x0A,
+      0x01, 0x0B,
+    },
+};
+
 void test_init(void) {
     struct OLEDM display;
     struct Text text;
@@ -101,31 +196,21 @@ void test_str(void) {
 
     assert_u32_array_equal(
         ((uint32_t[]){
-            // Draw the |
-            OLEDM_SET_BOUNDS, 16, 3, 16, 4,
+            // One window for the whole string, filled a row at a time
+            OLEDM_SET_BOUNDS, 16, 3, 22, 4,
             OLEDM_START_PIXELS,
-            OLEDM_WRITE_PIXELS, 0xFF,
-            OLEDM_WRITE_PIXELS, 0xFF,
-            OLEDM_STOP,
-
-            // Draw the -
-            OLEDM_SET_BOUNDS, 17, 3, 19, 4,
-            OLEDM_START_PIXELS,
-            OLEDM_WRITE_PIXELS, 0x01,
+            OLEDM_WRITE_PIXELS, 0xFF,  // |
+            OLEDM_WRITE_PIXELS, 0x01,  // -
             OLEDM_WRITE_PIXELS, 0x01,
             OLEDM_WRITE_PIXELS, 0x01,
-            OLEDM_WRITE_PIXELS, 0x00,
-            OLEDM_WRITE_PIXELS, 0x00,
-            OLEDM_WRITE_PIXELS, 0x00,
-            OLEDM_STOP,
-
-            // Draw the +
-            OLEDM_SET_BOUNDS, 20, 3, 22, 4,
-            OLEDM_START_PIXELS,
-            OLEDM_WRITE_PIXELS, 0x01,
+            OLEDM_WRITE_PIXELS, 0x01,  // +
             OLEDM_WRITE_PIXELS, 0xFF,
             OLEDM_WRITE_PIXELS, 0x01,
+            OLEDM_WRITE_PIXELS, 0xFF,  // |
+            OLEDM_WRITE_PIXELS, 0x00,  // -
+            OLEDM_WRITE_PIXELS, 0x00,
             OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_WRITE_PIXELS, 0x00,  // +
             OLEDM_WRITE_PIXELS, 0xFF,
             OLEDM_WRITE_PIXELS, 0x00,
             OLEDM_STOP,
@@ -164,6 +249,55 @@ void test_str_Edge(void) {
     );
 }
 
+void test_str_Inverted(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &font, &display);
+    oledm_log_reset();
+
+    // Clipped on the right, with both literal and repeat sequences
+    text.column = 124;
+    text.row = 3;
+    text.options = TEXT_OPTION_INVERTED;
+    text_str(&text, "-+");
+
+    assert_int_equal(0, display.error);
+    assert_int_equal(128, text.column);
+    assert_u32_array_equal(
+        ((uint32_t[]){
+            OLEDM_SET_BOUNDS, 124, 3, 127, 4,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0xFE,  // -
+            OLEDM_WRITE_PIXELS, 0xFE,
+            OLEDM_WRITE_PIXELS, 0xFE,
+            OLEDM_WRITE_PIXELS, 0xFE,  // +
+            OLEDM_WRITE_PIXELS, 0xFF,  // -
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_WRITE_PIXELS, 0xFF,  // +
+            OLEDM_STOP,
+        }),
+        oledm_log,
+        oledm_logidx
+    );
+    // Repeated bytes are joined across glyphs and rows
+    assert_int_equal(2, oledm_write_calls);
+}
+
+void test_str_WriteCalls(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &font, &display);
+    oledm_log_reset();
+
+    text_str(&text, "|-+");
+    assert_int_equal(0, display.error);
+    // 0xFF, 0x01 x 3, [0x01 0xFF 0x01] buf, 0xFF, 0x00 x 3, [0x00 0xFF 0x00] buf
+    assert_int_equal(6, oledm_write_calls);
+}
+
 void test_str_OffRight(void) {
     struct OLEDM display;
     struct Text text;
@@ -237,6 +371,226 @@ void test_str_preerr(void) {
     assert_int_equal(0, oledm_logidx);
 }
 
+void test_str_Blank(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &blank_font, &display);
+    oledm_log_reset();
+
+    // The background could be anything, so spaces are sent
+    text.column = 10;
+    text.row = 1;
+    text_str(&text, " |");
+    assert_int_equal(13, text.column);
+    assert_u32_array_equal(
+        ((uint32_t[]){
+            OLEDM_SET_BOUNDS, 10, 1, 12, 1,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_STOP,
+        }),
+        oledm_log,
+        oledm_logidx
+    );
+
+    // On a cleared background, spaces just move the column
+    oledm_log_reset();
+    text.column = 10;
+    text.options = TEXT_OPTION_CLEARED;
+    text_str(&text, "  | |  ");
+    assert_int_equal(0, display.error);
+    assert_int_equal(22, text.column);
+    assert_u32_array_equal(
+        ((uint32_t[]){
+            OLEDM_SET_BOUNDS, 14, 1, 14, 1,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_STOP,
+            OLEDM_SET_BOUNDS, 17, 1, 17, 1,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_STOP,
+        }),
+        oledm_log,
+        oledm_logidx
+    );
+
+    // Unless the text is inverted
+    oledm_log_reset();
+    text.column = 10;
+    text.options = TEXT_OPTION_CLEARED | TEXT_OPTION_INVERTED;
+    text_str(&text, " ");
+    assert_int_equal(12, text.column);
+    assert_u32_array_equal(
+        ((uint32_t[]){
+            OLEDM_SET_BOUNDS, 10, 1, 11, 1,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_STOP,
+        }),
+        oledm_log,
+        oledm_logidx
+    );
+
+    // Blank off the right side
+    oledm_log_reset();
+    text.column = 127;
+    text.options = TEXT_OPTION_CLEARED;
+    text_str(&text, "  |");
+    assert_int_equal(128, text.column);
+    assert_int_equal(0, oledm_logidx);
+}
+
+void test_measure(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &font, &display);
+    oledm_log_reset();
+
+    text.column = 126;
+    // unknown characters do not count and the right edge is ignored
+    assert_int_equal(7, text_measure(&text, "+x-|"));
+    assert_int_equal(3, text_measureLen(&text, "+-", 1));
+    assert_int_equal(0, text_measure(&text, ""));
+    assert_int_equal(126, text.column);
+    assert_int_equal(0, oledm_logidx);
+    assert_int_equal(0, display.error);
+}
+
+void test_dense_index(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &dense_font, &display);
+    assert_int_equal(0, display.error);
+    assert_int_equal('a', text.dense_first_char);
+    assert_int_equal(3, text.dense_count);
+    assert_int_equal(2, text.dense_index);
+    oledm_log_reset();
+
+    // \0 and d are not in the font
+    text_strLen(&text, "cb\0 ad", 6);
+    assert_int_equal(0, display.error);
+    assert_int_equal(4, text.column);
+    assert_u32_array_equal(
+        ((uint32_t[]){
+            OLEDM_SET_BOUNDS, 0, 0, 3, 0,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0x0C,
+            OLEDM_WRITE_PIXELS, 0x0B,
+            OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_WRITE_PIXELS, 0x0A,
+            OLEDM_STOP,
+        }),
+        oledm_log,
+        oledm_logidx
+    );
+}
+
+void test_font_switch(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &dense_font, &display);
+    assert_int_equal(0, (uint8_t*)text.verified_font - (uint8_t*)&dense_font);
+
+    // switching to a font without an index
+    text.font = (const uint8_t*)&font;
+    text_str(&text, "|");
+    assert_int_equal(0, display.error);
+    assert_int_equal(0, (uint8_t*)text.verified_font - (uint8_t*)&font);
+    assert_int_equal(0, text.dense_count);
+
+    text.font = (const uint8_t*)&bad_index_font;
+    text_str(&text, "a");
+    assert_int_equal(TEXT_BAD_FONT_INDEX_ERROR, display.error);
+
+    oledm_basic_init(&display);
+    text_init(&text, &bad_index_font, &display);
+    assert_int_equal(TEXT_BAD_FONT_INDEX_ERROR, display.error);
+}
+
+void test_str_Reversed(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &font, &display);
+    oledm_log_reset();
+    text.column = 16;
+    text.row = 3;
+    text_str(&text, "|-+");
+    uint32_t expected[5 + 1 + 14 * 2 + 1];
+    assert_int_equal(sizeof(expected) / sizeof(expected[0]), oledm_logidx);
+    memcpy(expected, oledm_log, sizeof(expected));
+
+    text_init(&text, &reversed_font, &display);
+    oledm_log_reset();
+    text.column = 16;
+    text.row = 3;
+    text_str(&text, "|-+");
+
+    assert_int_equal(0, display.error);
+    assert_int_equal(23, text.column);
+    assert_int_equal(2, text_height(&text));
+    // oledm_fake.c logs reversed writes in normal bit order
+    assert_u32_array_equal(expected, oledm_log, oledm_logidx);
+    assert_int_equal(oledm_write_calls, oledm_write_reversed_calls);
+}
+
+void test_str_Replay(void) {
+    struct OLEDM display;
+    struct Text text;
+    oledm_basic_init(&display);
+    text_init(&text, &replay_font, &display);
+    oledm_log_reset();
+
+    text.column = 16;
+    text.row = 3;
+    text_str(&text, "#|+");
+
+    assert_int_equal(0, display.error);
+    assert_int_equal(23, text.column);
+    assert_u32_array_equal(
+        ((uint32_t[]){
+            OLEDM_SET_BOUNDS, 16, 3, 22, 4,
+            OLEDM_START_PIXELS,
+            OLEDM_WRITE_PIXELS, 0x01,  // #
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_WRITE_PIXELS, 0x01,
+            OLEDM_WRITE_PIXELS, 0xFF,  // |
+            OLEDM_WRITE_PIXELS, 0x01,  // +
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_WRITE_PIXELS, 0x01,
+            OLEDM_WRITE_PIXELS, 0x00,  // #
+            OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_WRITE_PIXELS, 0xFF,  // |
+            OLEDM_WRITE_PIXELS, 0x00,  // +
+            OLEDM_WRITE_PIXELS, 0xFF,
+            OLEDM_WRITE_PIXELS, 0x00,
+            OLEDM_STOP,
+        }),
+        oledm_log,
+        oledm_logidx
+    );
+
+    // replays are checked for blank glyphs too
+    oledm_log_reset();
+    text.options = TEXT_OPTION_CLEARED;
+    text_str(&text, " ");
+    assert_int_equal(0, display.error);
+    assert_int_equal(26, text.column);
+    assert_int_equal(0, oledm_logidx);
+
+    text_str(&text, "!");
+    assert_int_equal(TEXT_INVALID_RLE_DATA, display.error);
+}
+
 void test_clear_row(void) {
     struct OLEDM display;
     struct Text text;
@@ -268,16 +622,26 @@ void test_clear_row(void) {
         oledm_log,
         oledm_logidx
     );
+    // Sent as a single run
+    assert_int_equal(1, oledm_write_calls);
 }
 
 int main(void) {
     test(test_init);
     test(test_str);
     test(test_str_Edge);
+    test(test_str_Inverted);
+    test(test_str_WriteCalls);
     test(test_str_OffRight);
     test(test_str_OffBottom);
     test(test_str_Empty);
     test(test_str_preerr);
+    test(test_str_Blank);
+    test(test_measure);
+    test(test_dense_index);
+    test(test_font_switch);
+    test(test_str_Reversed);
+    test(test_str_Replay);
     test(test_clear_row);
 
     return 0;
@@ -0,0 +1,324 @@
+// Host benchmark for the VariableFont code in text.c, using the fonts of
+// the clock.  Build and run with "make bench" in this directory.
+//
+// Flash reads are counted since those are what a lookup costs on the AVR
+// (an LPM and the address math around it).  Host time is also shown but
+// is only useful for comparing rows against each other.
+//
+// lookup: find_character_data() for every character in the font.  "search"
+// is the binary search that every font used before the dense index.
+//
+// render: text_str() of the clock digits into oledm_fake.c.  Write calls are
+// calls into the display driver, each of which has its own setup cost
+// before the SPI loop.
+//
+// decode: rendering every glyph in the font, as stored, against the same
+// glyph encoded with plain RLE (VAR1).  VAR2 fonts replay earlier data, which
+// costs a few reads per replay.  This is what to look at when choosing
+// whether a font should have "compress: true" in its yaml.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../oledm_fake.c"
+#include "../text.c"
+
+#include "../../../clock_number_font.c"
+#include "../../../detail_numbers_font.c"
+#include "../../../gps_stats_font.c"
+#include "../../../labels_font.c"
+#include "../../../pressure_font.c"
+#include "../../../sun_moon_icons.c"
+
+#define ITERATIONS 100000
+
+uint32_t pgm_reads;
+
+struct BenchFont {
+  const char* name;
+  const uint8_t* font;
+  uint16_t size;
+};
+
+#define BENCH_FONT(f) {#f, f, sizeof(f)}
+
+static const struct BenchFont fonts[] = {
+  BENCH_FONT(clock_number_font),
+  BENCH_FONT(detail_numbers_font),
+  BENCH_FONT(gps_stats_font),
+  BENCH_FONT(labels_font),
+  BENCH_FONT(pressure_font),
+  BENCH_FONT(sun_moon_icons),
+};
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Fills chars with every character in the font.  Returns the count.
+static uint8_t font_chars(const uint8_t* font, char* chars) {
+  const struct VariableFont* f = (const struct VariableFont*)font;
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < f->num_chars; ++i) {
+    if (f->data[(i << 2) + 1]) {
+      // not the dense index
+      chars[count++] = f->data[i << 2];
+    }
+  }
+  return count;
+}
+
+// Looks up every character and returns flash reads per lookup.  The time
+// per lookup goes into ns.
+static double bench_lookup(
+    struct Text* text, const char* chars, uint8_t count, double* ns) {
+  volatile uintptr_t sink = 0;
+  uint8_t width;
+  pgm_reads = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    sink += (uintptr_t)find_character_data(text, chars[i], &width);
+  }
+  const double reads = (double)pgm_reads / count;
+
+  const double start = now_ns();
+  for (uint32_t n = 0; n < ITERATIONS; ++n) {
+    for (uint8_t i = 0; i < count; ++i) {
+      sink += (uintptr_t)find_character_data(text, chars[i], &width);
+    }
+  }
+  *ns = (now_ns() - start) / ((double)ITERATIONS * count);
+  return reads;
+}
+
+// Appends a sequence to out.  See rle_encode()
+static uint16_t add_sequence(
+    uint8_t* out, uint16_t len, const uint8_t* run, uint8_t run_len,
+    bool_t repeat) {
+  if (repeat) {
+    out[len++] = run_len;
+    out[len++] = run[0];
+  } else {
+    out[len++] = 0x80 | run_len;
+    memcpy(out + len, run, run_len);
+    len += run_len;
+  }
+  return len;
+}
+
+// Same as run_length_encode() in make_var_font.py.  Returns the length.
+static uint16_t rle_encode(const uint8_t* data, uint16_t count, uint8_t* out) {
+  uint8_t run[127];
+  uint8_t run_len = 0;
+  bool_t repeat = 1;  // all of run is the same byte
+  uint16_t len = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    const uint8_t b = data[i];
+    if (run_len < 2) {
+      repeat = run_len == 0 || b == run[0];
+      run[run_len++] = b;
+    } else if (b == run[run_len - 1]) {
+      if (!repeat) {
+        // the changing part goes out without its last byte
+        len = add_sequence(out, len, run, run_len - 1, 0);
+        run[0] = b;
+        run_len = 1;
+        repeat = 1;
+      }
+      run[run_len++] = b;
+    } else if (repeat) {
+      len = add_sequence(out, len, run, run_len, 1);
+      run[0] = b;
+      run_len = 1;
+    } else {
+      run[run_len++] = b;
+    }
+
+    if (run_len == 127) {
+      len = add_sequence(out, len, run, run_len, repeat);
+      run_len = 0;
+    }
+  }
+  if (run_len) {
+    len = add_sequence(out, len, run, run_len, repeat);
+  }
+  return len;
+}
+
+// Decodes count bytes into out
+static void decode_glyph(const uint8_t* pgm_data, uint16_t count, uint8_t* out) {
+  struct RLETracker tracker;
+  error_t err = 0;
+  start_rle(&tracker, pgm_data);
+  for (uint16_t i = 0; i < count; ++i) {
+    out[i] = next_rle_byte(&tracker, &err);
+  }
+}
+
+// Sends a glyph the way that render_glyphs() does, a row at a time.
+// Returns flash reads.
+static uint32_t render_glyph(
+    struct OLEDM* display, const uint8_t* pgm_data, uint8_t width, uint8_t height) {
+  struct RLETracker tracker;
+  struct PixelRun run = {0x00, 0, 0};
+  start_rle(&tracker, pgm_data);
+  oledm_log_reset();
+  pgm_reads = 0;
+  for (uint8_t row = 0; row < height; ++row) {
+    write_rle_bytes(display, &tracker, width, width, 0x00, &run);
+  }
+  flush_run(display, &run);
+  return pgm_reads;
+}
+
+// Returns the time to render a glyph, in ns
+static double time_render(
+    struct OLEDM* display, const uint8_t* pgm_data, uint8_t width, uint8_t height) {
+  const double start = now_ns();
+  for (uint32_t n = 0; n < ITERATIONS / 100; ++n) {
+    render_glyph(display, pgm_data, width, height);
+  }
+  return (now_ns() - start) / (ITERATIONS / 100);
+}
+
+// Totals for bench_decode()
+struct DecodeStats {
+  uint16_t glyphs;
+  uint16_t rle_bytes;
+  uint16_t bytes;
+  uint32_t rle_reads;
+  uint32_t reads;
+  double rle_ns;
+  double ns;
+};
+
+// Renders every glyph of the font as stored and as plain RLE
+static void bench_decode(
+    struct OLEDM* display, const struct BenchFont* bf, struct DecodeStats* stats) {
+  const struct VariableFont* f = (const struct VariableFont*)bf->font;
+  const uint8_t height = f->height & VARIABLE_FONT_HEIGHT_MASK;
+  const uint16_t data_size = bf->size - 6;
+  memset(stats, 0, sizeof(*stats));
+  for (uint8_t i = 0; i < f->num_chars; ++i) {
+    const uint8_t* slot = f->data + (i << 2);
+    const uint16_t offset = (slot[2] << 8) | slot[3];
+    if (slot[1] == 0) {
+      // the dense index
+      continue;
+    }
+    // The glyph ends where the next one in the data starts.  Shared data
+    // is only counted once.
+    uint16_t end = data_size;
+    bool_t shared = 0;
+    for (uint8_t j = 0; j < f->num_chars; ++j) {
+      const uint8_t* other = f->data + (j << 2);
+      const uint16_t other_offset = (other[2] << 8) | other[3];
+      if (!other[1]) {
+        continue;
+      }
+      if ((other_offset == offset) && (j < i)) {
+        shared = 1;
+      }
+      if ((other_offset > offset) && (other_offset < end)) {
+        end = other_offset;
+      }
+    }
+    if (shared) {
+      continue;
+    }
+
+    const uint8_t width = slot[1];
+    const uint16_t count = (uint16_t)width * height;
+    uint8_t decoded[1024];
+    uint8_t rle[1024 + 16];
+    decode_glyph(f->data + offset, count, decoded);
+
+    ++stats->glyphs;
+    stats->bytes += end - offset;
+    stats->rle_bytes += rle_encode(decoded, count, rle);
+    stats->reads += render_glyph(display, f->data + offset, width, height);
+    stats->rle_reads += render_glyph(display, rle, width, height);
+    stats->ns += time_render(display, f->data + offset, width, height);
+    stats->rle_ns += time_render(display, rle, width, height);
+    if (display->error) {
+      printf("%s: error 0x%02X\n", bf->name, display->error);
+      return;
+    }
+  }
+}
+
+int main(void) {
+  struct OLEDM display;
+  struct Text text;
+  oledm_basic_init(&display);
+
+  printf("%-22s %5s %6s  %14s  %14s\n",
+      "font", "chars", "dense", "search (reads)", "lookup (reads)");
+  for (uint8_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); ++i) {
+    text_init(&text, fonts[i].font, &display);
+    if (display.error) {
+      printf("%s: error 0x%02X\n", fonts[i].name, display.error);
+      return 1;
+    }
+    char chars[256];
+    const uint8_t count = font_chars(fonts[i].font, chars);
+
+    double lookup_ns;
+    const double lookup = bench_lookup(&text, chars, count, &lookup_ns);
+    const uint8_t dense_count = text.dense_count;
+    text.dense_count = 0;
+    double search_ns;
+    const double search = bench_lookup(&text, chars, count, &search_ns);
+
+    printf("%-22s %5u %6u  %5.1f %6.1fns  %5.1f %6.1fns\n",
+        fonts[i].name, count, dense_count,
+        search, search_ns, lookup, lookup_ns);
+  }
+
+  printf("\n%-22s %6s %6s %6s  %16s  %16s\n",
+      "font", "glyphs", "VAR1", "stored", "VAR1 (reads/gl)", "stored (reads/gl)");
+  for (uint8_t i = 0; i < sizeof(fonts) / sizeof(fonts[0]); ++i) {
+    struct DecodeStats stats;
+    bench_decode(&display, fonts + i, &stats);
+    printf("%-22s %6u %6u %6u  %5.0f %8.0fns  %5.0f %8.0fns\n",
+        fonts[i].name, stats.glyphs, stats.rle_bytes, stats.bytes,
+        (double)stats.rle_reads / stats.glyphs, stats.rle_ns / stats.glyphs,
+        (double)stats.reads / stats.glyphs, stats.ns / stats.glyphs);
+  }
+
+  // Render the clock, sized like the SSD1680
+  display.memory_columns = 296;
+  display.memory_rows = 16;
+  text_init(&text, clock_number_font, &display);
+  oledm_log_reset();
+  pgm_reads = 0;
+  text_str(&text, "12:34");
+  const uint32_t render_reads = pgm_reads;
+  const uint16_t render_calls = oledm_write_calls;
+  const uint16_t render_bytes = (oledm_logidx - 7) / 2;
+  const double start = now_ns();
+  for (uint32_t n = 0; n < ITERATIONS / 100; ++n) {
+    oledm_log_reset();
+    text.column = 0;
+    text_str(&text, "12:34");
+  }
+  const double render_ns = (now_ns() - start) / (ITERATIONS / 100);
+  printf("\nrender \"12:34\": %u bytes, %u write calls, %u reads, %.0fns\n",
+      render_bytes, render_calls, render_reads, render_ns);
+
+  // Font switches, like display.c does between labels and numbers
+  pgm_reads = 0;
+  text_init(&text, labels_font, &display);
+  const uint32_t init_reads = pgm_reads;
+  pgm_reads = 0;
+  text.font = detail_numbers_font;
+  text_verifyFont(&text);
+  const uint32_t switch_reads = pgm_reads;
+  pgm_reads = 0;
+  text_verifyFont(&text);
+  printf("\nverify: %u reads at init, %u after a font switch, %u otherwise\n",
+      init_reads, switch_reads, pgm_reads);
+  return 0;
+}
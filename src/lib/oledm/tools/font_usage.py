@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+"""Finds the characters that C sources render with each font.
+
+Usage: font_usage.py <font name>... -- <source.c>...
+
+make_var_font.py uses this to drop glyphs that are never drawn (see the
+subset option there).  Only string and character literals are found.
+Characters that come from numbers (u8_to_ps() and friends) or variables
+have to be declared in the font's yaml.
+
+The scan is simple, not a C parser:
+
+  - The font of a Text is whatever was last assigned with "text.font = X"
+    or text_init(&text, X, ...) in the function, ignoring control flow.  A
+    ternary like "a ? font1 : font2" selects both.
+  - A function that renders text before assigning a font uses the font of
+    its caller.
+  - Literals can reach text_str() through function parameters and fonts can
+    reach "text.font =" the same way, e.g. render_i32x100(v, "%rH", 2,
+    number_font, label_font).
+  - Functions that are never called directly (they are in a table of
+    function pointers) start with the fonts passed to text_init() in the
+    same file.  If there are none, the literals count for every font.
+"""
+
+from typing import Dict, List, Optional, Set, Tuple
+
+import re
+import sys
+
+TOKEN_RE = re.compile(r'''
+    (?P<comment>//[^\n]*|/\*.*?\*/)
+  | (?P<string>"(?:\\.|[^"\\])*")
+  | (?P<char>'(?:\\.|[^'\\])+')
+  | (?P<ident>[A-Za-z_]\w*)
+  | (?P<number>\d\w*)
+  | (?P<preproc>\#[^\n]*)
+  | (?P<space>\s+)
+  | (?P<punct>->|.)
+''', re.VERBOSE | re.DOTALL)
+
+TEXT_FUNCTIONS = ('text_str', 'text_char', 'text_strLen')
+
+# A font or a set of characters.  Either a set of font names (or
+# characters), 'caller' for the font of the calling function or an int to
+# take it from that parameter of the function.
+Source = object
+
+class Token:
+  """A C token.  kind is one of the TOKEN_RE group names."""
+  def __init__(self, kind: str, value: str):
+    self.kind = kind
+    self.value = value
+
+  def __repr__(self):
+    return self.value
+
+
+class Function:
+  """What a function renders."""
+  def __init__(self, name: str, params: List[str]):
+    self.name = name
+    self.params = params
+    # (characters, font) pairs.  See Source.
+    self.renders: List[Tuple[Source, Source]] = []
+    self.calls: List[Tuple[str, List[List[Token]], Source]] = []
+
+
+def unescape(literal: str) -> str:
+  """Returns the characters of a C string or character literal."""
+  return bytes(literal[1:-1], 'utf8').decode('unicode_escape')
+
+
+def tokenize(src: str) -> List[Token]:
+  tokens = []
+  for m in TOKEN_RE.finditer(src):
+    if m.lastgroup not in ('comment', 'space', 'preproc'):
+      tokens.append(Token(m.lastgroup, m.group()))
+  return tokens
+
+
+def split_args(tokens: List[Token], start: int) -> Tuple[List[List[Token]], int]:
+  """Splits the arguments of the call with '(' at start.
+
+  Returns the arguments and the index after the closing ')'.
+  """
+  args: List[List[Token]] = [[]]
+  depth = 0
+  i = start
+  while i < len(tokens):
+    t = tokens[i].value
+    if t in '([{':
+      depth += 1
+      if depth > 1:
+        args[-1].append(tokens[i])
+    elif t in ')]}':
+      depth -= 1
+      if depth == 0:
+        return args, i + 1
+      args[-1].append(tokens[i])
+    elif t == ',' and depth == 1:
+      args.append([])
+    else:
+      args[-1].append(tokens[i])
+    i += 1
+  return args, i
+
+
+def param_names(args: List[List[Token]]) -> List[str]:
+  """Returns the name of each parameter in a parameter list."""
+  names = []
+  for arg in args:
+    idents = [t.value for t in arg if t.kind == 'ident']
+    names.append(idents[-1] if idents else '')
+  return names
+
+
+class SourceFile:
+  """The functions of one .c file."""
+  def __init__(self, path: str, fonts: Set[str]):
+    self.path = path
+    self.fonts = fonts
+    self.functions: Dict[str, Function] = {}
+    # fonts passed to text_init()
+    self.init_fonts: Set[str] = set()
+    with open(path, encoding='utf8') as f:
+      tokens = tokenize(f.read())
+    self._find_functions(tokens)
+
+  def _find_functions(self, tokens: List[Token]) -> None:
+    depth = 0
+    i = 0
+    while i < len(tokens):
+      t = tokens[i].value
+      if t == '{':
+        depth += 1
+      elif t == '}':
+        depth -= 1
+      elif (depth == 0 and tokens[i].kind == 'ident' and
+            i + 1 < len(tokens) and tokens[i + 1].value == '('):
+        args, end = split_args(tokens, i + 1)
+        if end < len(tokens) and tokens[end].value == '{':
+          func = Function(t, param_names(args))
+          self.functions[t] = func
+          i = self._scan_body(func, tokens, end)
+          continue
+        i = end
+        continue
+      i += 1
+
+  def source_of(self, func: Function, arg: List[Token]) -> Optional[Source]:
+    """Returns the fonts named in arg, or the parameter it comes from."""
+    fonts = {t.value for t in arg if t.value in self.fonts}
+    if fonts:
+      return fonts
+    for t in arg:
+      if t.value in func.params:
+        return func.params.index(t.value)
+    return None
+
+  def chars_of(self, func: Function, arg: List[Token]) -> Source:
+    """Returns the literal characters in arg, or the parameter they are."""
+    chars = set()
+    for t in arg:
+      if t.kind in ('string', 'char'):
+        chars |= set(unescape(t.value))
+    if not chars and len(arg) == 1 and arg[0].value in func.params:
+      return func.params.index(arg[0].value)
+    return chars
+
+  def _scan_body(self, func: Function, tokens: List[Token], i: int) -> int:
+    """Scans the function body starting at '{'.  Returns the index after."""
+    font: Source = 'caller'
+    depth = 0
+    while i < len(tokens):
+      t = tokens[i].value
+      if t == '{':
+        depth += 1
+      elif t == '}':
+        depth -= 1
+        if depth == 0:
+          return i + 1
+      elif (t == 'font' and i + 2 < len(tokens) and
+            tokens[i - 1].value in ('.', '->') and tokens[i + 1].value == '='):
+        end = i + 2
+        while tokens[end].value != ';':
+          end += 1
+        source = self.source_of(func, tokens[i + 2:end])
+        font = source if source is not None else set(self.fonts)
+        i = end
+        continue
+      elif (tokens[i].kind == 'ident' and i + 1 < len(tokens) and
+            tokens[i + 1].value == '('):
+        args, end = split_args(tokens, i + 1)
+        if t == 'text_init' and len(args) > 1:
+          source = self.source_of(func, args[1])
+          font = source if source is not None else set(self.fonts)
+          if isinstance(source, set):
+            self.init_fonts |= source
+        elif t in TEXT_FUNCTIONS and len(args) > 1:
+          func.renders.append((self.chars_of(func, args[1]), font))
+        else:
+          func.calls.append((t, args, font))
+        # arguments can hold calls too
+        i += 2
+        continue
+      i += 1
+    return i
+
+
+class Usage:
+  """Per font characters for a set of source files."""
+  def __init__(self, paths: List[str], fonts: Set[str]):
+    self.fonts = fonts
+    self.files = [SourceFile(p, fonts) for p in paths]
+    self.called: Set[Tuple[str, str]] = set()
+    for sf in self.files:
+      for func in sf.functions.values():
+        for name, _, _ in func.calls:
+          callee = self._find(sf, name)
+          if callee:
+            self.called.add((callee[0].path, name))
+    self.summaries: Dict[Tuple[str, str], List[Tuple[Source, Source]]] = {}
+
+  def _find(
+      self, sf: SourceFile, name: str) -> Optional[Tuple[SourceFile, Function]]:
+    """Finds a function, looking in sf first since it might be static."""
+    if name in sf.functions:
+      return sf, sf.functions[name]
+    for other in self.files:
+      if name in other.functions:
+        return other, other.functions[name]
+    return None
+
+  def _summary(
+      self,
+      sf: SourceFile,
+      func: Function,
+      active: Set[Tuple[str, str]]) -> List[Tuple[Source, Source]]:
+    """Returns what the function renders, including through calls."""
+    key = (sf.path, func.name)
+    if key in self.summaries:
+      return self.summaries[key]
+    if key in active:
+      # recursion
+      return []
+    active.add(key)
+    renders = list(func.renders)
+    for name, args, font in func.calls:
+      callee = self._find(sf, name)
+      if not callee:
+        continue
+      for chars, callee_font in self._summary(callee[0], callee[1], active):
+        renders.append((
+            self._resolve_chars(sf, func, chars, args),
+            self._resolve_font(sf, func, callee_font, args, font)))
+    active.remove(key)
+    self.summaries[key] = renders
+    return renders
+
+  @staticmethod
+  def _resolve_chars(
+      sf: SourceFile,
+      func: Function,
+      chars: Source,
+      args: List[List[Token]]) -> Source:
+    """Returns the characters of a callee in terms of the caller."""
+    if isinstance(chars, int):
+      return sf.chars_of(func, args[chars]) if chars < len(args) else set()
+    return chars
+
+  def _resolve_font(
+      self,
+      sf: SourceFile,
+      func: Function,
+      font: Source,
+      args: List[List[Token]],
+      caller_font: Source) -> Source:
+    """Returns the font of a callee in terms of the caller."""
+    if font == 'caller':
+      return caller_font
+    if isinstance(font, int):
+      source = sf.source_of(func, args[font]) if font < len(args) else None
+      return source if source is not None else set(self.fonts)
+    return font
+
+  def chars(self) -> Dict[str, Set[str]]:
+    """Returns the characters rendered with each font."""
+    result: Dict[str, Set[str]] = {f: set() for f in self.fonts}
+    for sf in self.files:
+      default = sf.init_fonts or set(self.fonts)
+      for name, func in sf.functions.items():
+        if (sf.path, name) in self.called:
+          continue
+        for chars, font in self._summary(sf, func, set()):
+          if not isinstance(chars, set):
+            continue
+          if not isinstance(font, set):
+            font = default
+          for f in font:
+            result[f] |= chars
+    return result
+
+
+def font_chars(paths: List[str], fonts: Set[str]) -> Dict[str, Set[str]]:
+  """Returns the characters that paths render with each font."""
+  return Usage(paths, fonts).chars()
+
+
+def main():
+  """Entry point."""
+  if '--' not in sys.argv:
+    sys.exit('Usage: font_usage.py <font name>... -- <source.c>...')
+  split = sys.argv.index('--')
+  fonts = set(sys.argv[1:split])
+  for font, chars in sorted(font_chars(sys.argv[split + 1:], fonts).items()):
+    print('%s: %s' % (font, repr(''.join(sorted(chars)))))
+
+
+if __name__ == '__main__':
+  main()
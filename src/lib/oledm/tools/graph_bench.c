@@ -0,0 +1,93 @@
+// Host benchmark for graph_display.c, drawing a graph the size of the
+// pressure graph (150 x 6 rows) into oledm_fake.c.  Build and run with
+// "make bench" in this directory.
+//
+// There is no AVR simulator here, so the work is counted instead of timed:
+//
+// data: calls to the data callback.  pressure_graph.c scales a point in
+// each one (a 16x32 multiply on the AVR).
+//
+// tics: calls to the tic mark callback, a modulo in pressure_graph.c.
+//
+// flash: PROGMEM reads for the span masks.
+//
+// writes: calls into the display driver, each of which has its own setup
+// cost before the SPI loop.  Both send the same 900 bytes.
+//
+// Host time is only useful for comparing rows against each other.
+
+#include <stdio.h>
+#include <time.h>
+
+#include "../oledm_fake.c"
+#include "../graph_display.c"
+
+#define ITERATIONS 10000
+#define COLUMNS 150
+#define ROWS 6
+
+uint32_t pgm_reads;
+
+static uint8_t data[COLUMNS];
+static uint32_t data_calls;
+static uint32_t tic_calls;
+
+static uint8_t data_callback(column_t column) {
+  ++data_calls;
+  return data[column];
+}
+
+// Same as pressure_graph.c
+static uint8_t every6(column_t column) {
+  ++tic_calls;
+  return (column % 6) == 0 ? 3 : 0;
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench(
+    const char* name,
+    struct GraphDisplay* gd,
+    void (*render)(struct GraphDisplay*, column_t, uint8_t)) {
+  data_calls = 0;
+  tic_calls = 0;
+  pgm_reads = 0;
+  oledm_log_reset();
+  render(gd, 0, 10);
+  printf("%-8s %6u %6u %6u %7u",
+      name, data_calls, tic_calls, pgm_reads, oledm_write_calls);
+
+  const double start = now_ns();
+  for (uint32_t n = 0; n < ITERATIONS; ++n) {
+    oledm_log_reset();
+    render(gd, 0, 10);
+  }
+  printf(" %8.0fns\n", (now_ns() - start) / ITERATIONS);
+}
+
+int main(void) {
+  struct OLEDM display;
+  struct GraphDisplay gd;
+  oledm_basic_init(&display);
+  display.memory_columns = 296;
+  display.memory_rows = 16;
+
+  // a day of falling then rising pressure
+  for (uint8_t i = 0; i < COLUMNS; ++i) {
+    data[i] = i < 100 ? 40 - i * 35 / 100 : 5 + (i - 100) * 38 / 50;
+  }
+  graph_display_init(&gd, &display, COLUMNS, ROWS, 0);
+  gd.data_callback = data_callback;
+  gd.ticmark_callback = every6;
+  gd.column_offset = 37;
+
+  printf("%-8s %6s %6s %6s %7s %10s\n",
+      "render", "data", "tics", "flash", "writes", "time");
+  bench("rows", &gd, graph_display_render);
+  bench("columns", &gd, graph_display_render_columns);
+  return 0;
+}
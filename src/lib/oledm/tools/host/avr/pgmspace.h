@@ -0,0 +1,14 @@
+// Host stand-in for avr/pgmspace.h, used by font_bench.c.  Flash is plain
+// memory and every read is counted, since each one is an LPM on the AVR.
+#ifndef TOOLS_HOST_AVR_PGMSPACE_H
+#define TOOLS_HOST_AVR_PGMSPACE_H
+
+#include <inttypes.h>
+
+extern uint32_t pgm_reads;
+
+#define PROGMEM
+#define pgm_read_byte_near(p) (++pgm_reads, *(const uint8_t*)(p))
+#define pgm_read_byte(p) pgm_read_byte_near(p)
+
+#endif
@@ -1,13 +1,18 @@
 #!/usr/bin/env python3
 """Turns a description .yaml into a output file (debug or c source)."""
 
-from typing import Any, Dict, List, IO
+from typing import Any, Dict, List, IO, Optional, Tuple
 
 import pathlib
 import sys
 from PIL import Image, ImageDraw, ImageFont
 import yaml
 
+import font_usage
+
+# Bytes in a VAR2 replay sequence
+REPLAY_SIZE = 4
+
 class Error(Exception):
   pass
 
@@ -224,18 +229,52 @@ def generate_character_comment(c: str, img: Image.Image, fout: IO) -> None:
     fout.write('\n')
 
 
+def find_dense_range(chars: List[str]) -> Tuple[str, int]:
+  """Returns the first character and length of the longest contiguous run."""
+  best_first, best_count = chars[0], 1
+  first, count = chars[0], 1
+  for prev, c in zip(chars, chars[1:]):
+    if ord(c) == ord(prev) + 1:
+      count += 1
+    else:
+      first, count = c, 1
+    if count > best_count:
+      best_first, best_count = first, count
+  return best_first, best_count
+
+
 def generate_offsets(
     fout: IO,
     char_to_img: Dict[str, Image.Image],
-    char_to_data: Dict[str, List[int]]) -> None:
+    char_to_data: Dict[str, List[int]],
+    dense_index: bool) -> None:
+  """Writes the table of characters, see VariableFont in text.h.
+
+  Characters with the same data share it.
+  """
   fout.write('    // Character offsets\n')
-  # 3 bytes per character plus the end byte
-  offset = len(char_to_img) * 4
-  for c, img in sorted(char_to_img.items()):
+  chars = sorted(char_to_img)
+  num_entries = len(chars) + (1 if dense_index else 0)
+  # 4 bytes per character
+  offset = num_entries * 4
+  if dense_index:
+    first, count = find_dense_range(chars)
+    fout.write('    0, 0, 0x%02X, %d,  // dense index %s-%s\n' % (
+        ord(first), count, first, chr(ord(first) + count - 1)))
+  data_to_offset = {}
+  for c in chars:
+    img = char_to_img[c]
     if ord(c) < 32 or ord(c) > 128:
       c_rep = '%d' % ord(c)
     else:
       c_rep = '\'%c\'' % c
+    data = tuple(char_to_data[c])
+    if data in data_to_offset:
+      fout.write('    %s, %d, 0x%02X, 0x%02X,  // off=%d (shared)\n' % (
+          c_rep, img.width, data_to_offset[data] >> 8,
+          data_to_offset[data] & 0xFF, data_to_offset[data]))
+      continue
+    data_to_offset[data] = offset
     fout.write('    %s, %d, 0x%02X, 0x%02X,  // off=%d\n' % (
     c_rep, img.width, offset >> 8, offset & 0xFF, offset))
     offset += len(char_to_data[c])
@@ -246,28 +285,175 @@ def generate_character_data(data: List[int], fout: IO) -> None:
     fout.write('    %s,\n' % ', '.join('0x%02X' % b for b in chunk))
 
 
-def create_rle_data(rows: int, img: Image.Image) -> List[int]:
+def glyph_bytes(
+    rows: int, img: Image.Image, reverse_bits: bool) -> List[int]:
+  """Returns the display bytes of a character, a row at a time.
+
+  The top pixel of a byte is bit 0, or bit 7 when reverse_bits is set.
+  """
   data = []
   for row in range(rows):
     for x in range(img.width):
       byte = 0x00
       for row_y in range(8):
         if img.getpixel((x, row * 8 + row_y)):
-          byte = byte | 1 << row_y
+          byte = byte | 1 << (7 - row_y if reverse_bits else row_y)
       data.append(byte)
+  return data
+
+
+def create_rle_data(
+    rows: int, img: Image.Image, reverse_bits: bool) -> List[int]:
+  """Returns RLE data for a character."""
+  return run_length_encode(glyph_bytes(rows, img, reverse_bits))
+
+
+def decode_for_replay(stream: List[int]) -> Tuple[List[Optional[int]], List[int]]:
+  """Decodes VAR2 data for replay_encode().
+
+  Returns the decoded bytes and, for each sequence that can be replayed,
+  its offset in stream and in the decoded bytes.  Replays decode to a None
+  since they can not be replayed themselves.
+  """
+  decoded: List[Optional[int]] = []
+  starts = []
+  i = 0
+  while i < len(stream):
+    header = stream[i]
+    if header == 0:
+      decoded.append(None)
+      i += 4
+      continue
+    starts.append((i, len(decoded)))
+    if header & 0x80:
+      decoded.extend(stream[i + 1:i + 1 + (header & 0x7F)])
+      i += 1 + (header & 0x7F)
+    else:
+      decoded.extend([stream[i + 1]] * header)
+      i += 2
+  return decoded, starts
+
+
+def replay_encode(data: List[int], history: List[int]) -> List[int]:
+  """Encodes data as VAR2, which can replay earlier data.
+
+  history is the font data that comes before data.  See VariableFont in
+  text.h for the format.  Greedily takes the longest replay that is smaller
+  than the RLE data it replaces.
+  """
+  out: List[int] = []
+  pending: List[int] = []
+  i = 0
+  while i < len(data):
+    decoded, starts = decode_for_replay(history + out)
+    best_length, best_offset = 0, 0
+    for offset, start in starts:
+      length = 0
+      while (length < 255 and i + length < len(data) and
+             start + length < len(decoded) and
+             decoded[start + length] == data[i + length]):
+        length += 1
+      if length > best_length:
+        best_length, best_offset = length, offset
+    if (best_length and
+        len(run_length_encode(data[i:i + best_length])) > REPLAY_SIZE):
+      out.extend(run_length_encode(pending) if pending else [])
+      pending = []
+      distance = len(history) + len(out) - best_offset
+      out.extend((0x00, best_length, distance >> 8, distance & 0xFF))
+      i += best_length
+    else:
+      pending.append(data[i])
+      i += 1
+  if pending:
+    out.extend(run_length_encode(pending))
+  return out
 
-  return run_length_encode(data)
+
+def font_size(
+    char_to_data: Dict[str, List[int]], dense_index: bool) -> Tuple[int, int]:
+  """Returns the table and data bytes of a VariableFont."""
+  entries = len(char_to_data) + (1 if dense_index else 0)
+  data = set(tuple(d) for d in char_to_data.values())
+  return 6 + entries * 4, sum(len(d) for d in data)
+
+
+def subset_chars(
+    path: str,
+    var_name: str,
+    char_to_img: Dict[str, Image.Image],
+    subset: Dict[str, Any]) -> Dict[str, Image.Image]:
+  """Returns the characters that the sources in subset render.
+
+  See font_usage.py.  Characters that do not come from literals (numbers
+  and such) are listed in subset['chars'].
+  """
+  fonts = {
+      p.with_suffix('').name.replace('.', '_').replace('-', '_')
+      for p in pathlib.Path(path).parent.glob('*.yaml')}
+  fonts.add(var_name)
+  used = font_usage.font_chars(subset['sources'], fonts)[var_name]
+  used |= set(subset.get('chars', ''))
+  return {c: img for c, img in char_to_img.items() if c in used}
+
+
+def compress_data(
+    rows: int,
+    char_to_img: Dict[str, Image.Image],
+    char_to_data: Dict[str, List[int]],
+    reverse_bits: bool) -> Tuple[Dict[str, List[int]], bool]:
+  """Returns the smaller of the RLE and VAR2 encodings of each character.
+
+  The data goes in the order that variable_font_dump() writes it.  Also
+  returns True if any character uses VAR2 replays.
+  """
+  history: List[int] = []
+  written = {}
+  compressed = {}
+  replays = False
+  for c in sorted(char_to_img):
+    rle = char_to_data[c]
+    if tuple(rle) in written:
+      # shared with an earlier character
+      compressed[c] = written[tuple(rle)]
+      continue
+    data = replay_encode(
+        glyph_bytes(rows, char_to_img[c], reverse_bits), history)
+    if len(data) >= len(rle) or data in written.values():
+      # Equal data with replays would decode differently from here
+      data = rle
+    else:
+      replays = True
+    written[tuple(rle)] = data
+    compressed[c] = data
+    history.extend(data)
+  return compressed, replays
 
 
 def variable_font_dump(
     path: str,
-    char_to_img: Dict[str, Image.Image]) -> None:
+    char_to_img: Dict[str, Image.Image],
+    dense_index: bool,
+    reverse_bits: bool,
+    subset: Optional[Dict[str, Any]],
+    compress: bool) -> None:
   """Dumps .c and .h files."""
   out_path = pathlib.Path(path).with_suffix('.c')
   var_name = out_path.with_suffix('').name.replace('.', '_').replace('-', '_')
   dump_c_header(path, var_name)
 
   rows = next(iter(char_to_img.values())).height // 8
+  all_data = {
+      c:create_rle_data(rows, img, reverse_bits)
+      for c, img in char_to_img.items()}
+  if subset:
+    char_to_img = subset_chars(path, var_name, char_to_img, subset)
+  char_to_data = {c: all_data[c] for c in char_to_img}
+  rle_table, rle_data = font_size(char_to_data, dense_index)
+  replays = False
+  if compress:
+    char_to_data, replays = compress_data(
+        rows, char_to_img, char_to_data, reverse_bits)
 
   with out_path.open('w', encoding='utf8') as fout:
     fout.write('\n'.join((
@@ -277,19 +463,26 @@ def variable_font_dump(
         '#include <avr/pgmspace.h> ',
         '',
         'const uint8_t %s[] PROGMEM = {' % var_name,
-        '    0x56, 0x41, 0x52, 0x31,  // id: VAR1',
-        '    0x%02X, // num_chars' % len(char_to_img),
-        '    0x%02X, // height' % rows,
+        '    0x56, 0x41, 0x52, 0x3%d,  // id: VAR%d' % (
+            (2, 2) if replays else (1, 1)),
+        '    0x%02X, // num_chars' % (
+            len(char_to_img) + (1 if dense_index else 0)),
+        '    0x%02X, // height%s' % (
+            rows | (0x80 if reverse_bits else 0),
+            ' | VARIABLE_FONT_REVERSED' if reverse_bits else ''),
         '',
         '',
     )))
 
-    char_to_data = {
-        c:create_rle_data(rows, img) for c, img in char_to_img.items()}
-    generate_offsets(fout, char_to_img, char_to_data)
+    generate_offsets(fout, char_to_img, char_to_data, dense_index)
 
     fout.write('    // Character data\n')
+    written = set()
     for c, img in sorted(char_to_img.items()):
+      data = tuple(char_to_data[c])
+      if data in written:
+        continue
+      written.add(data)
       generate_character_comment(c, img, fout)
       generate_character_data(char_to_data[c], fout)
 
@@ -297,6 +490,20 @@ def variable_font_dump(
 
   print('Wrote %s' % out_path)
 
+  # Size report
+  table, data = font_size(char_to_data, dense_index)
+  print('%s: %d characters, %d bytes (table %d, data %d)' % (
+      var_name, len(char_to_data), table + data, table, data))
+  if compress:
+    print('%s: VAR2 replays save %d bytes' % (
+        var_name, rle_table + rle_data - table - data))
+  dropped = sorted(set(all_data) - set(char_to_data))
+  if dropped:
+    full_table, full_data = font_size(all_data, dense_index)
+    print('%s: dropped %d unused characters %s, saving %d bytes' % (
+        var_name, len(dropped), repr(''.join(dropped)),
+        full_table + full_data - table - data))
+
 
 def main():
   """Entry point."""
@@ -317,7 +524,13 @@ def main():
   if cfg['output_type'] == 'debug':
     debug_dump(char_to_img)
   elif cfg['output_type'] == 'VariableFont':
-    variable_font_dump(path, char_to_img)
+    variable_font_dump(
+        path,
+        char_to_img,
+        cfg.get('dense_index', False),
+        cfg.get('reverse_bits', False),
+        cfg.get('subset'),
+        cfg.get('compress', False))
   else:
     raise InvalidOutputTypeError(
         'Invalid output type: %s' % cfg['output_type'])
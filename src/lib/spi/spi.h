@@ -48,7 +48,29 @@ void spi_initMasterFreq(uint8_t flags, uint32_t freq);
 //   2) call spi_sync_read and spi_sync_write as many times as needed to read and write bytes
 //   3) reraise the SS pin
 void spi_syncWrite(uint8_t data);
+// Writes data count times.  Same as calling spi_syncWrite in a loop but
+// without the call overhead between bytes.
+void spi_syncWriteRun(uint8_t data, uint16_t count);
 uint8_t spi_syncTransact(uint8_t data);  // write and read
 uint8_t spi_syncRead();
 
+#ifdef SPI_ASYNC
+// Queued writes (ATMega only).  Each call adds an entry to a small ring and
+// returns.  Bytes are sent by the SPI transfer complete interrupt.  If the
+// ring is full, the caller sleeps (idle mode) until there is room.  The
+// interrupt state of the caller is kept.  With interrupts disabled, nothing
+// is sent until they are enabled again or a call has to wait, which then
+// sends the bytes itself.
+//
+// Queued bytes go out in the order they were added.  Call spi_asyncFlush()
+// before toggling CS or D/C, or before using the sync functions above.
+void spi_asyncWriteRun(uint8_t data, uint16_t count);
+// If progmem is non-zero, buf is in flash and is queued like a run.
+// Otherwise buf is in RAM and is sent before this returns, so the caller
+// can reuse it.
+void spi_asyncWriteBuf(const uint8_t* buf, uint16_t len, uint8_t progmem);
+// Sleeps (idle mode) until every queued byte has been sent.
+void spi_asyncFlush(void);
+#endif
+
 #endif  // APILIB_SPI
@@ -0,0 +1,119 @@
+#define SPI_ASYNC
+#include "spi.h"
+
+#include <avr/pgmspace.h>
+#include <test/unit_test.h>
+
+// Directly include the implementation so that SPI_ASYNC is defined for it
+#include "spi_atmega.c"
+
+// Stands in for the hardware finishing a byte
+static void transfer_complete(void) {
+    SPI_STC_vect();
+}
+
+void test_asyncWriteRun(void) {
+    SPCR = 0;
+    spi_asyncWriteRun(0xAB, 3);
+    // The first byte is sent right away
+    assert_reg_equal(0xAB, SPDR);
+    assert_reg_equal(1 << SPIE, SPCR);
+
+    SPDR = 0;
+    transfer_complete();
+    assert_reg_equal(0xAB, SPDR);
+    SPDR = 0;
+    transfer_complete();
+    assert_reg_equal(0xAB, SPDR);
+
+    SPDR = 0;
+    transfer_complete();
+    assert_reg_equal(0x00, SPDR);
+    assert_reg_equal(0, SPCR);
+    assert_int_equal(0, queue_busy);
+}
+
+static const uint8_t pgm_data[] PROGMEM = {0x01, 0x02};
+
+void test_asyncWriteOrder(void) {
+    SPCR = 0;
+    spi_asyncWriteRun(0xC0, 1);
+    spi_asyncWriteBuf(pgm_data, sizeof(pgm_data), 1);
+    spi_asyncWriteRun(0xD0, 0);  // ignored
+    spi_asyncWriteRun(0xE0, 1);
+    spi_asyncWriteRun(0xE0, 1);  // joins the previous run
+
+    const uint8_t expected[] = {0xC0, 0x01, 0x02, 0xE0, 0xE0};
+    for (uint8_t i=0; i < sizeof(expected); ++i) {
+      assert_reg_equal(expected[i], SPDR);
+      assert_int_equal(1, queue_busy);
+      SPDR = 0;
+      transfer_complete();
+    }
+    assert_reg_equal(0x00, SPDR);
+    assert_int_equal(0, queue_busy);
+    spi_asyncFlush();  // returns right away
+}
+
+void test_asyncJoinRuns(void) {
+    SPCR = 0;
+    // More single bytes than the queue has entries
+    for (uint8_t i=0; i < SPI_QUEUE_SIZE * 2; ++i) {
+      spi_asyncWriteRun(0x5A, 1);
+    }
+    // The first byte went out right away, the rest share one entry
+    assert_int_equal(2, (queue_tail - queue_head) & (SPI_QUEUE_SIZE - 1));
+
+    for (uint8_t i=0; i < SPI_QUEUE_SIZE * 2; ++i) {
+      assert_reg_equal(0x5A, SPDR);
+      SPDR = 0;
+      transfer_complete();
+    }
+    assert_reg_equal(0x00, SPDR);
+    assert_int_equal(0, queue_busy);
+}
+
+void test_asyncWriteRam(void) {
+    const uint8_t ram_data[] = {0x11, 0x12, 0x13};
+    SPCR = 0;
+    // With interrupts off, waiting sends the bytes without the ISR.  Every
+    // byte is finished right away here.
+    SREG = 0;
+    SPSR = 1 << SPIF;
+    spi_asyncWriteBuf(pgm_data, sizeof(pgm_data), 1);
+    assert_int_equal(1, queue_busy);  // flash is only queued
+    spi_asyncWriteBuf(ram_data, sizeof(ram_data), 0);
+    // RAM is sent before returning, after what was queued before it
+    assert_int_equal(0, queue_busy);
+    assert_reg_equal(0x13, SPDR);
+    assert_reg_equal(0, SPCR);
+    assert_reg_equal(0, SREG);
+    SPSR = 0;
+}
+
+void test_asyncKeepsInterruptState(void) {
+    SPCR = 0;
+    SREG = 0;
+    spi_asyncWriteRun(0x12, 2);
+    assert_reg_equal(0, SREG);
+    SREG = 1 << SREG_I;
+    spi_asyncWriteRun(0x34, 1);
+    assert_reg_equal(1 << SREG_I, SREG);
+
+    const uint8_t expected[] = {0x12, 0x12, 0x34};
+    for (uint8_t i=0; i < sizeof(expected); ++i) {
+      assert_reg_equal(expected[i], SPDR);
+      SPDR = 0;
+      transfer_complete();
+    }
+    assert_int_equal(0, queue_busy);
+}
+
+int main(void) {
+    test(test_asyncWriteRun);
+    test(test_asyncWriteOrder);
+    test(test_asyncJoinRuns);
+    test(test_asyncWriteRam);
+    test(test_asyncKeepsInterruptState);
+    return 0;
+}
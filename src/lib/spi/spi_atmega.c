@@ -1,5 +1,11 @@
 #include "spi.h"
 
+#ifdef SPI_ASYNC
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#endif
+
 // Pin layouts.  You might need to access these directly in special cases.
 // For example, if using a chip that uses a single pin for MISO/MOSI, you'll
 // need to change the output state of the PIN yourself between reads and writes.
@@ -93,6 +99,13 @@ void spi_syncWrite(uint8_t data) {
   while (!(SPSR & (1 << SPIF)));
 }
 
+void spi_syncWriteRun(uint8_t data, uint16_t count) {
+  for (; count; --count) {
+    SPDR = data;
+    while (!(SPSR & (1 << SPIF)));
+  }
+}
+
 uint8_t spi_syncTransact(uint8_t data) {
   SPDR = data;
   while (!(SPSR & (1 << SPIF)));
@@ -103,3 +116,149 @@ uint8_t spi_syncRead() {
   while (!(SPSR & (1 << SPIF)));
   return SPDR;
 }
+
+#ifdef SPI_ASYNC
+
+#ifndef SPI_QUEUE_SIZE
+#define SPI_QUEUE_SIZE 8  // must be a power of 2
+#endif
+
+#define QUEUE_RUN 0
+#define QUEUE_RAM 1
+#define QUEUE_PROGMEM 2
+
+struct QueueEntry {
+  const uint8_t* buf;  // unused for QUEUE_RUN
+  uint16_t count;  // bytes left to send
+  uint8_t data;  // QUEUE_RUN only
+  uint8_t type;
+};
+
+static struct QueueEntry queue[SPI_QUEUE_SIZE];
+static volatile uint8_t queue_head;  // entry being sent
+static volatile uint8_t queue_tail;  // next free entry
+static volatile uint8_t queue_busy;
+
+#define NEXT_ENTRY(idx) (((idx) + 1) & (SPI_QUEUE_SIZE - 1))
+
+// Sends the next queued byte or turns the interrupt off if there is
+// nothing left.  Called from the ISR or with interrupts disabled.
+static void send_next(void) {
+  while (queue_head != queue_tail) {
+    struct QueueEntry* e = queue + queue_head;
+    if (e->count) {
+      --e->count;
+      switch (e->type) {
+        case QUEUE_RUN:
+          SPDR = e->data;
+          break;
+        case QUEUE_RAM:
+          SPDR = *(e->buf++);
+          break;
+        default:
+          SPDR = pgm_read_byte_near(e->buf++);
+          break;
+      }
+      return;
+    }
+    queue_head = NEXT_ENTRY(queue_head);
+  }
+  SPCR &= ~(1 << SPIE);
+  queue_busy = 0;
+}
+
+ISR(SPI_STC_vect) {
+  send_next();
+}
+
+// Sleeps until the next interrupt if a transfer is in progress.  The SPI
+// clock keeps running in idle mode but not in the deeper modes.  With
+// interrupts disabled the ISR can not run, so this waits for the byte and
+// sends the next one itself.
+static void sleep_while_busy(void) {
+  const uint8_t sreg = SREG;
+  if (!(sreg & (1 << SREG_I))) {
+    if (queue_busy) {
+      while (!(SPSR & (1 << SPIF)));
+      send_next();
+    }
+    return;
+  }
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  cli();
+  if (queue_busy) {
+    sleep_enable();
+    sei();  // the instruction after sei is always executed
+    sleep_cpu();
+    sleep_disable();
+  }
+  SREG = sreg;
+}
+
+static void enqueue(
+    const uint8_t* buf, uint8_t data, uint16_t count, uint8_t type) {
+  if (!count) {
+    return;
+  }
+
+  uint8_t sreg = SREG;
+  cli();
+  if ((type == QUEUE_RUN) && (queue_head != queue_tail)) {
+    // Extend the last run instead of adding an entry if it's the same byte.
+    // Lots of single bytes (such as pixels) end up as one entry this way.
+    struct QueueEntry* last =
+        queue + ((queue_tail - 1) & (SPI_QUEUE_SIZE - 1));
+    if ((last->type == QUEUE_RUN) &&
+        (last->data == data) &&
+        last->count &&
+        (last->count <= (0xFFFF - count))) {
+      last->count += count;
+      SREG = sreg;
+      return;
+    }
+  }
+  SREG = sreg;
+
+  while (NEXT_ENTRY(queue_tail) == queue_head) {
+    sleep_while_busy();  // ring is full
+  }
+
+  struct QueueEntry* e = queue + queue_tail;
+  e->buf = buf;
+  e->data = data;
+  e->count = count;
+  e->type = type;
+
+  sreg = SREG;
+  cli();
+  queue_tail = NEXT_ENTRY(queue_tail);
+  if (!queue_busy) {
+    queue_busy = 1;
+    // Reading SPSR then writing SPDR (in send_next) clears a SPIF left over
+    // from a sync write.  Otherwise the ISR would run right away.
+    (void)SPSR;
+    send_next();
+    SPCR |= (1 << SPIE);
+  }
+  SREG = sreg;
+}
+
+void spi_asyncWriteRun(uint8_t data, uint16_t count) {
+  enqueue(0, data, count, QUEUE_RUN);
+}
+
+void spi_asyncWriteBuf(const uint8_t* buf, uint16_t len, uint8_t progmem) {
+  enqueue(buf, 0, len, progmem ? QUEUE_PROGMEM : QUEUE_RAM);
+  if (!progmem) {
+    // Callers expect to reuse their buffer (e.g. a stack array) right away
+    spi_asyncFlush();
+  }
+}
+
+void spi_asyncFlush(void) {
+  while (queue_busy) {
+    sleep_while_busy();
+  }
+}
+
+#endif  // SPI_ASYNC
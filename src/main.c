@@ -69,6 +69,11 @@ struct MS8607 ms8607;
 // the value.
 volatile time_t current_time_y2k;
 
+// Counts the same interrupts as current_time_y2k but is never set, thus it
+// can time things while GPS or drift correction change the clock.  A single
+// byte so it can be read without disabling interrupts.
+volatile uint8_t uptime_seconds;
+
 // Stores non-volatile settings, like UTC time offset and 12/24h preference.
 struct EEPromVars eeprom;
 
@@ -88,6 +93,18 @@ uint8_t menu_mode;
 time_t next_clock_drift_correction;
 #endif
 
+// Number of seconds before the minute that the next frame is sampled and
+// sent to the display.  On the minute, the display then only needs to be
+// told to refresh, so it shows the new minute right away instead of several
+// seconds late.  The display stays awake (and the SPI pins enabled) for
+// these seconds.  Set to 0 to render on the minute instead.
+#ifndef RENDER_AHEAD_SECONDS
+#define RENDER_AHEAD_SECONDS 3
+#endif
+
+// When non-zero, the display RAM holds the frame for this time
+time_t prepared_time;
+
 // Call this to get the current time.  Avoid accessing current_time_y2k
 // directly becuase there is a risk of the interrupt handler updating
 // the time while in the middle of reading it.
@@ -98,6 +115,11 @@ static inline time_t snapshot_time_y2k(void) {
   return snapshot;
 }
 
+// See epaper_set_busy_sleep()
+static uint8_t snapshot_uptime_seconds(void) {
+  return uptime_seconds;
+}
+
 static inline void heartbeat_on(void) {
   HEARTBEAT_LED_PORT |= (1 << HEARTBEAT_LED_PIN);
 }
@@ -151,7 +173,7 @@ inline static void idle(void) {
 #elif defined(SOFTWARE_UART)
       TIMER0_ON,  // Software UART needs timer 0 to function
 #endif
-      SPI_OFF,
+      SPI_OFF,  // display.c re-inits SPI after the wake, see busy_sleep()
 #if defined(HARDWARE_UART) || defined(DEBUG)
       USART0_ON,
 #elif defined(SOFTWARE_UART)
@@ -160,12 +182,9 @@ inline static void idle(void) {
       TWI_OFF);
 } 
 
+// Also the busy sleep for the display (see display_init()), which calls this
+// with interrupts disabled.  lowpower enables them as it goes to sleep.
 static void wait_for_next_second(void) {
-#ifdef SOFTWARE_UART
-  // We can't blink in the interrupt handler so blink here instead
-  heartbeat();
-#endif
-
 #if defined(USE_32K_CRYSTAL)
   if (menu_mode || gps_is_enabled()) {
     // GPS is enabled so we need to use the idle form of power save
@@ -189,6 +208,12 @@ static void wait_for_next_second(void) {
   #error Please define either USE_32K_CRYSTAL or USE_CPU_CRYSTAL
 #endif
 
+#ifdef SOFTWARE_UART
+  // We can't blink in the interrupt handler so blink here instead.  This is
+  // after the sleep so the software UART is not held off by the delay.
+  heartbeat();
+#endif
+
   // check on every wait to provide relief to the GPS receive buffer, which may
   // not be large enough to endure several rounds of information (waiting too long
   // leads to new messages being lost until the buffer is processed)
@@ -236,12 +261,33 @@ static void init(void) {
   ms8607_init(&ms8607);
   timer_init();
   sei();  // enable global interrupts
-  display_init();
+  display_init(wait_for_next_second, snapshot_uptime_seconds);
+}
+
+// Samples the Pressure/Humidity/Temperature sensor and GPS state.
+static void collect_data(struct DisplayInfo* dinfo, const time_t time_y2k) {
+  dinfo->time_y2k = time_y2k;
+  dinfo->position_was_set = gps_position_was_set();
+  ms8607_read_values(
+      &ms8607, &(dinfo->temp_cc), &(dinfo->pressure_pa), &(dinfo->humidity_cpct));
+}
+
+// Sends the frame for the upcoming minute to the display without showing it.
+// See RENDER_AHEAD_SECONDS
+static void prepare_next_frame(const time_t next_update) {
+  struct DisplayInfo dinfo;
+  display_enable_spi();
+  collect_data(&dinfo, next_update);
+  display_prepare(&dinfo, &eeprom);
+  prepared_time = next_update;
 }
 
 // Sample data from the Pressure/Humidity/Temperature sensor
 // and update the epaper display with the latest information.
 static void collect_data_and_update_display(uint8_t button_pressed, const time_t current_ytk) {
+  const time_t frame_time = prepared_time;
+  prepared_time = 0;
+
   if (menu_mode) {
     // menummode uses the higher-power eapaper fast-update
     // thus we do not disable SPI
@@ -254,10 +300,15 @@ static void collect_data_and_update_display(uint8_t button_pressed, const time_t
   }
 
   if (!menu_mode) {
+    if (!button_pressed && (frame_time == current_ytk)) {
+      // Already rendered, see prepare_next_frame()
+      display_show();
+      display_disable_spi();
+      return;
+    }
+
     const struct GPSStats* gps_stats = gps_get_stats();
     struct DisplayInfo dinfo;
-    dinfo.time_y2k = current_ytk;
-    dinfo.position_was_set = gps_position_was_set();
 
     if (button_pressed == SELECT_WAS_PRESSED) {
       gps_stat_show_policy(
@@ -267,9 +318,8 @@ static void collect_data_and_update_display(uint8_t button_pressed, const time_t
     }
 
     display_enable_spi();
-    ms8607_read_values(
-        &ms8607, &(dinfo.temp_cc), &(dinfo.pressure_pa), &(dinfo.humidity_cpct));
-    update_display(&dinfo, &eeprom, wait_for_next_second);
+    collect_data(&dinfo, current_ytk);
+    update_display(&dinfo, &eeprom);
     display_disable_spi();
   }
 }
@@ -319,6 +369,13 @@ static time_t loop(time_t next_update) {
 #endif
       position_set_trigger = position_was_set;
     }
+  } else if (RENDER_AHEAD_SECONDS &&
+             !menu_mode &&
+             !prepared_time &&
+             ((next_update - current_ytk) <= RENDER_AHEAD_SECONDS)) {
+    // The wake-up that increments the time comes from the timer overflow,
+    // thus the refresh will start within a few ms of the minute.
+    prepare_next_frame(next_update);
   }
 
   return next_update;
@@ -350,6 +407,7 @@ ISR(TIMER1_COMPA_vect)
   heartbeat();
 #endif
   ++current_time_y2k;
+  ++uptime_seconds;
 }
 
 
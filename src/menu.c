@@ -213,6 +213,7 @@ static uint8_t update_menu_internal(
       init_display_for_partial_refresh(current_y2k, eeprom);
     } else if (selected_row == FINISHED) {
       display_recalc_sunrise_sunset();
+      display_force_full_refresh();
       return 0;
     }
   }
@@ -4,9 +4,9 @@
 #include <avr/pgmspace.h> 
 
 const uint8_t pressure_font[] PROGMEM = {
-    0x56, 0x41, 0x52, 0x31,  // id: VAR1
+    0x56, 0x41, 0x52, 0x32,  // id: VAR2
     0x28, // num_chars
-    0x02, // height
+    0x82, // height | VARIABLE_FONT_REVERSED
 
     // Character offsets
     ' ', 9, 0x00, 0xA0,  // off=160
@@ -20,35 +20,35 @@ const uint8_t pressure_font[] PROGMEM = {
     '4', 9, 0x01, 0x08,  // off=264
     '5', 9, 0x01, 0x1D,  // off=285
     '6', 9, 0x01, 0x2F,  // off=303
-    '7', 9, 0x01, 0x42,  // off=322
-    '8', 9, 0x01, 0x52,  // off=338
-    '9', 9, 0x01, 0x63,  // off=355
-    ':', 9, 0x01, 0x76,  // off=374
-    'A', 10, 0x01, 0x80,  // off=384
-    'C', 9, 0x01, 0x98,  // off=408
-    'D', 9, 0x01, 0xAD,  // off=429
-    'E', 9, 0x01, 0xBF,  // off=447
-    'F', 9, 0x01, 0xCD,  // off=461
-    'G', 9, 0x01, 0xDA,  // off=474
-    'H', 9, 0x01, 0xEF,  // off=495
-    'I', 9, 0x01, 0xFF,  // off=511
-    'K', 9, 0x02, 0x0F,  // off=527
-    'L', 9, 0x02, 0x23,  // off=547
-    'M', 10, 0x02, 0x2D,  // off=557
-    'N', 9, 0x02, 0x45,  // off=581
-    'O', 9, 0x02, 0x5B,  // off=603
-    'P', 9, 0x02, 0x70,  // off=624
-    'R', 9, 0x02, 0x80,  // off=640
-    'S', 9, 0x02, 0x92,  // off=658
-    'T', 9, 0x02, 0xA5,  // off=677
-    'U', 9, 0x02, 0xB1,  // off=689
-    'Z', 9, 0x02, 0xC2,  // off=706
-    'a', 10, 0x02, 0xD5,  // off=725
-    'h', 9, 0x02, 0xEA,  // off=746
-    'i', 9, 0x02, 0xFC,  // off=764
-    'm', 9, 0x03, 0x0C,  // off=780
-    'n', 9, 0x03, 0x22,  // off=802
-    'x', 9, 0x03, 0x34,  // off=820
+    '7', 9, 0x01, 0x41,  // off=321
+    '8', 9, 0x01, 0x51,  // off=337
+    '9', 9, 0x01, 0x62,  // off=354
+    ':', 9, 0x01, 0x75,  // off=373
+    'A', 10, 0x01, 0x7F,  // off=383
+    'C', 9, 0x01, 0x97,  // off=407
+    'D', 9, 0x01, 0xAC,  // off=428
+    'E', 9, 0x01, 0xBE,  // off=446
+    'F', 9, 0x01, 0xCC,  // off=460
+    'G', 9, 0x01, 0xD4,  // off=468
+    'H', 9, 0x01, 0xE3,  // off=483
+    'I', 9, 0x01, 0xF3,  // off=499
+    'K', 9, 0x01, 0xFF,  // off=511
+    'L', 9, 0x02, 0x13,  // off=531
+    'M', 10, 0x02, 0x1D,  // off=541
+    'N', 9, 0x02, 0x33,  // off=563
+    'O', 9, 0x02, 0x47,  // off=583
+    'P', 9, 0x02, 0x58,  // off=600
+    'R', 9, 0x02, 0x68,  // off=616
+    'S', 9, 0x02, 0x78,  // off=632
+    'T', 9, 0x02, 0x8B,  // off=651
+    'U', 9, 0x02, 0x95,  // off=661
+    'Z', 9, 0x02, 0xA6,  // off=678
+    'a', 10, 0x02, 0xB9,  // off=697
+    'h', 9, 0x02, 0xCE,  // off=718
+    'i', 9, 0x02, 0xE0,  // off=736
+    'm', 9, 0x02, 0xEA,  // off=746
+    'n', 9, 0x02, 0xFD,  // off=765
+    'x', 9, 0x03, 0x03,  // off=771
     // Character data
     // Character 32 (0x20) ( )
     // ---------
@@ -85,7 +85,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ---------
     // ---------
     // ---------
-    0x03, 0x00, 0x02, 0xE0, 0x04, 0x00, 0x03, 0x03, 0x02, 0x1F, 0x03, 0x03, 0x01, 0x00,
+    0x03, 0x00, 0x02, 0x07, 0x04, 0x00, 0x03, 0xC0, 0x02, 0xF8, 0x03, 0xC0, 0x01, 0x00,
     // Character 45 (0x2D) (-)
     // ---------
     // ---------
@@ -103,7 +103,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ---------
     // ---------
     // ---------
-    0x0B, 0x00, 0x04, 0x03, 0x03, 0x00,
+    0x0B, 0x00, 0x04, 0xC0, 0x03, 0x00,
     // Character 46 (0x2E) (.)
     // -----
     // -----
@@ -121,7 +121,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // -##--
     // -----
     // -----
-    0x06, 0x00, 0x02, 0x30, 0x02, 0x00,
+    0x06, 0x00, 0x02, 0x0C, 0x02, 0x00,
     // Character 48 (0x30) (0)
     // ---------
     // ---------
@@ -139,8 +139,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x83, 0xE0, 0xF0, 0x38, 0x02, 0x98, 0x87, 0x38, 0xF0, 0xE0, 0x00, 0x0F, 0x1F, 0x38, 0x02, 0x31,
-    0x84, 0x38, 0x1F, 0x0F, 0x00,
+    0x83, 0x07, 0x0F, 0x1C, 0x02, 0x19, 0x87, 0x1C, 0x0F, 0x07, 0x00, 0xF0, 0xF8, 0x1C, 0x02, 0x8C,
+    0x84, 0x1C, 0xF8, 0xF0, 0x00,
     // Character 49 (0x31) (1)
     // ---------
     // ---------
@@ -158,7 +158,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x02, 0x60, 0x81, 0x30, 0x02, 0xF8, 0x04, 0x00, 0x03, 0x30, 0x02, 0x3F, 0x03, 0x30, 0x01, 0x00,
+    0x02, 0x06, 0x81, 0x0C, 0x02, 0x1F, 0x04, 0x00, 0x03, 0x0C, 0x02, 0xFC, 0x03, 0x0C, 0x01, 0x00,
     // Character 50 (0x32) (2)
     // ---------
     // ---------
@@ -176,8 +176,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x02, 0x30, 0x03, 0x18, 0x8A, 0x98, 0xF0, 0x70, 0x00, 0x38, 0x3C, 0x36, 0x32, 0x33, 0x31, 0x02,
-    0x30, 0x01, 0x00,
+    0x02, 0x0C, 0x03, 0x18, 0x8A, 0x19, 0x0F, 0x0E, 0x00, 0x1C, 0x3C, 0x6C, 0x4C, 0xCC, 0x8C, 0x02,
+    0x0C, 0x01, 0x00,
     // Character 51 (0x33) (3)
     // ---------
     // ---------
@@ -195,8 +195,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x02, 0x30, 0x81, 0x18, 0x03, 0x98, 0x83, 0xF8, 0x70, 0x00, 0x02, 0x18, 0x81, 0x30, 0x03, 0x31,
-    0x83, 0x1F, 0x0E, 0x00,
+    0x02, 0x0C, 0x81, 0x18, 0x03, 0x19, 0x83, 0x1F, 0x0E, 0x00, 0x02, 0x18, 0x81, 0x0C, 0x03, 0x8C,
+    0x83, 0xF8, 0x70, 0x00,
     // Character 52 (0x34) (4)
     // ---------
     // ---------
@@ -214,8 +214,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // -----##--
     // ---------
     // ---------
-    0x02, 0x00, 0x83, 0xC0, 0xE0, 0x38, 0x02, 0xF8, 0x02, 0x00, 0x83, 0x0E, 0x0F, 0x0D, 0x02, 0x0C,
-    0x02, 0x3F, 0x82, 0x0C, 0x00,
+    0x02, 0x00, 0x83, 0x03, 0x07, 0x1C, 0x02, 0x1F, 0x02, 0x00, 0x83, 0x70, 0xF0, 0xB0, 0x02, 0x30,
+    0x02, 0xFC, 0x82, 0x30, 0x00,
     // Character 53 (0x35) (5)
     // ---------
     // ---------
@@ -233,8 +233,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x02, 0xF8, 0x04, 0xD8, 0x81, 0x98, 0x02, 0x00, 0x82, 0x09, 0x19, 0x03, 0x30, 0x84, 0x39, 0x1F,
-    0x0F, 0x00,
+    0x02, 0x1F, 0x04, 0x1B, 0x81, 0x19, 0x02, 0x00, 0x82, 0x90, 0x98, 0x03, 0x0C, 0x84, 0x9C, 0xF8,
+    0xF0, 0x00,
     // Character 54 (0x36) (6)
     // ---------
     // ---------
@@ -252,8 +252,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x83, 0xE0, 0xF0, 0x38, 0x03, 0x98, 0x86, 0x38, 0x30, 0x00, 0x07, 0x1F, 0x39, 0x03, 0x31, 0x83,
-    0x1F, 0x0F, 0x00,
+    0x00, 0x05, 0x00, 0x73, 0x87, 0x19, 0x1C, 0x0C, 0x00, 0xE0, 0xF8, 0x9C, 0x03, 0x8C, 0x83, 0xF8,
+    0xF0, 0x00,
     // Character 55 (0x37) (7)
     // ---------
     // ---------
@@ -271,7 +271,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // --##-----
     // ---------
     // ---------
-    0x04, 0x18, 0x84, 0x98, 0xD8, 0x78, 0x38, 0x03, 0x00, 0x84, 0x38, 0x3E, 0x07, 0x01, 0x03, 0x00,
+    0x04, 0x18, 0x84, 0x19, 0x1B, 0x1E, 0x1C, 0x03, 0x00, 0x84, 0x1C, 0x7C, 0xE0, 0x80, 0x03, 0x00,
     // Character 56 (0x38) (8)
     // ---------
     // ---------
@@ -289,7 +289,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x82, 0x70, 0xF8, 0x04, 0x98, 0x85, 0xF8, 0x70, 0x00, 0x1E, 0x1F, 0x04, 0x31, 0x83, 0x1F, 0x1E,
+    0x82, 0x0E, 0x1F, 0x04, 0x19, 0x85, 0x1F, 0x0E, 0x00, 0x78, 0xF8, 0x04, 0x8C, 0x83, 0xF8, 0x78,
     0x00,
     // Character 57 (0x39) (9)
     // ---------
@@ -308,8 +308,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // -#####---
     // ---------
     // ---------
-    0x82, 0xE0, 0xF0, 0x03, 0x18, 0x86, 0x38, 0xF0, 0xE0, 0x00, 0x18, 0x39, 0x03, 0x33, 0x84, 0x39,
-    0x1F, 0x07, 0x00,
+    0x82, 0x07, 0x0F, 0x03, 0x18, 0x86, 0x1C, 0x0F, 0x07, 0x00, 0x18, 0x9C, 0x03, 0xCC, 0x84, 0x9C,
+    0xF8, 0xE0, 0x00,
     // Character 58 (0x3A) (:)
     // ---------
     // ---------
@@ -327,7 +327,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ---##----
     // ---------
     // ---------
-    0x03, 0x00, 0x02, 0x60, 0x07, 0x00, 0x02, 0x30, 0x04, 0x00,
+    0x03, 0x00, 0x02, 0x06, 0x07, 0x00, 0x02, 0x0C, 0x04, 0x00,
     // Character 65 (0x41) (A)
     // ----------
     // ----------
@@ -345,8 +345,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##------##
     // ----------
     // ----------
-    0x02, 0x00, 0x82, 0x80, 0xF0, 0x02, 0x38, 0x82, 0xF0, 0x80, 0x02, 0x00, 0x84, 0x20, 0x3C, 0x1F,
-    0x07, 0x02, 0x06, 0x84, 0x07, 0x1F, 0x3C, 0x20,
+    0x02, 0x00, 0x82, 0x01, 0x0F, 0x02, 0x1C, 0x82, 0x0F, 0x01, 0x02, 0x00, 0x84, 0x04, 0x3C, 0xF8,
+    0xE0, 0x02, 0x60, 0x84, 0xE0, 0xF8, 0x3C, 0x04,
     // Character 67 (0x43) (C)
     // ---------
     // ---------
@@ -364,8 +364,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x83, 0xE0, 0xF0, 0x38, 0x02, 0x18, 0x87, 0x38, 0x70, 0x60, 0x00, 0x0F, 0x1F, 0x38, 0x02, 0x30,
-    0x84, 0x38, 0x1C, 0x0C, 0x00,
+    0x83, 0x07, 0x0F, 0x1C, 0x02, 0x18, 0x87, 0x1C, 0x0E, 0x06, 0x00, 0xF0, 0xF8, 0x1C, 0x02, 0x0C,
+    0x84, 0x1C, 0x38, 0x30, 0x00,
     // Character 68 (0x44) (D)
     // ---------
     // ---------
@@ -383,8 +383,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ######---
     // ---------
     // ---------
-    0x02, 0xF8, 0x03, 0x18, 0x84, 0x38, 0xF0, 0xC0, 0x00, 0x02, 0x3F, 0x03, 0x30, 0x84, 0x38, 0x1F,
-    0x07, 0x00,
+    0x02, 0x1F, 0x03, 0x18, 0x84, 0x1C, 0x0F, 0x03, 0x00, 0x02, 0xFC, 0x03, 0x0C, 0x84, 0x1C, 0xF8,
+    0xE0, 0x00,
     // Character 69 (0x45) (E)
     // ---------
     // ---------
@@ -402,7 +402,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x02, 0xF8, 0x05, 0x98, 0x82, 0x18, 0x00, 0x02, 0x3F, 0x05, 0x31, 0x82, 0x30, 0x00,
+    0x02, 0x1F, 0x05, 0x19, 0x82, 0x18, 0x00, 0x02, 0xFC, 0x05, 0x8C, 0x82, 0x0C, 0x00,
     // Character 70 (0x46) (F)
     // ---------
     // ---------
@@ -420,7 +420,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##-------
     // ---------
     // ---------
-    0x02, 0xF8, 0x05, 0x98, 0x82, 0x18, 0x00, 0x02, 0x3F, 0x05, 0x01, 0x02, 0x00,
+    0x00, 0x0B, 0x00, 0x0E, 0x05, 0x80, 0x02, 0x00,
     // Character 71 (0x47) (G)
     // ---------
     // ---------
@@ -438,8 +438,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x83, 0xE0, 0xF0, 0x38, 0x02, 0x18, 0x88, 0x38, 0x70, 0x60, 0x00, 0x07, 0x1F, 0x38, 0x30, 0x02,
-    0x33, 0x02, 0x1F, 0x01, 0x00,
+    0x00, 0x09, 0x00, 0x3D, 0x84, 0xE0, 0xF8, 0x1C, 0x0C, 0x02, 0xCC, 0x02, 0xF8, 0x01, 0x00,
     // Character 72 (0x48) (H)
     // ---------
     // ---------
@@ -457,7 +456,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##----##-
     // ---------
     // ---------
-    0x02, 0xF8, 0x04, 0x80, 0x02, 0xF8, 0x81, 0x00, 0x02, 0x3F, 0x04, 0x01, 0x02, 0x3F, 0x01, 0x00,
+    0x02, 0x1F, 0x04, 0x01, 0x02, 0x1F, 0x81, 0x00, 0x02, 0xFC, 0x04, 0x80, 0x02, 0xFC, 0x01, 0x00,
     // Character 73 (0x49) (I)
     // ---------
     // ---------
@@ -475,7 +474,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x03, 0x18, 0x02, 0xF8, 0x03, 0x18, 0x81, 0x00, 0x03, 0x30, 0x02, 0x3F, 0x03, 0x30, 0x01, 0x00,
+    0x03, 0x18, 0x02, 0x1F, 0x03, 0x18, 0x01, 0x00, 0x00, 0x09, 0x01, 0x22,
     // Character 75 (0x4B) (K)
     // ---------
     // ---------
@@ -493,8 +492,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##----###
     // ---------
     // ---------
-    0x02, 0xF8, 0x87, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x08, 0x00, 0x02, 0x3F, 0x02, 0x03, 0x85, 0x07,
-    0x0E, 0x38, 0x30, 0x20,
+    0x02, 0x1F, 0x87, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x10, 0x00, 0x02, 0xFC, 0x02, 0xC0, 0x85, 0xE0,
+    0x70, 0x1C, 0x0C, 0x04,
     // Character 76 (0x4C) (L)
     // ---------
     // ---------
@@ -512,7 +511,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x02, 0xF8, 0x07, 0x00, 0x02, 0x3F, 0x06, 0x30, 0x01, 0x00,
+    0x02, 0x1F, 0x07, 0x00, 0x02, 0xFC, 0x06, 0x0C, 0x01, 0x00,
     // Character 77 (0x4D) (M)
     // ----------
     // ----------
@@ -530,8 +529,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##-----##-
     // ----------
     // ----------
-    0x02, 0xF8, 0x85, 0x78, 0xE0, 0x00, 0xE0, 0x78, 0x02, 0xF8, 0x81, 0x00, 0x02, 0x3F, 0x85, 0x00,
-    0x03, 0x06, 0x07, 0x00, 0x02, 0x3F, 0x01, 0x00,
+    0x02, 0x1F, 0x85, 0x1E, 0x07, 0x00, 0x07, 0x1E, 0x00, 0x05, 0x00, 0x3E, 0x85, 0x00, 0xC0, 0x60,
+    0xE0, 0x00, 0x02, 0xFC, 0x01, 0x00,
     // Character 78 (0x4E) (N)
     // ---------
     // ---------
@@ -549,8 +548,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##---###-
     // ---------
     // ---------
-    0x02, 0xF8, 0x84, 0x78, 0xE0, 0x80, 0x00, 0x02, 0xF8, 0x81, 0x00, 0x02, 0x3F, 0x84, 0x00, 0x03,
-    0x0F, 0x3C, 0x02, 0x3F, 0x01, 0x00,
+    0x00, 0x04, 0x00, 0x16, 0x82, 0x01, 0x00, 0x00, 0x05, 0x00, 0x53, 0x84, 0x00, 0xC0, 0xF0, 0x3C,
+    0x02, 0xFC, 0x01, 0x00,
     // Character 79 (0x4F) (O)
     // ---------
     // ---------
@@ -568,8 +567,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x83, 0xE0, 0xF0, 0x38, 0x02, 0x18, 0x87, 0x38, 0xF0, 0xE0, 0x00, 0x0F, 0x1F, 0x38, 0x02, 0x30,
-    0x84, 0x38, 0x1F, 0x0F, 0x00,
+    0x00, 0x06, 0x00, 0xB0, 0x86, 0x0F, 0x07, 0x00, 0xF0, 0xF8, 0x1C, 0x02, 0x0C, 0x00, 0x04, 0x01,
+    0x88,
     // Character 80 (0x50) (P)
     // ---------
     // ---------
@@ -587,7 +586,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##-------
     // ---------
     // ---------
-    0x02, 0xF8, 0x04, 0x18, 0x83, 0xF0, 0xE0, 0x00, 0x02, 0x3F, 0x04, 0x03, 0x81, 0x01, 0x02, 0x00,
+    0x02, 0x1F, 0x04, 0x18, 0x83, 0x0F, 0x07, 0x00, 0x02, 0xFC, 0x04, 0xC0, 0x81, 0x80, 0x02, 0x00,
     // Character 82 (0x52) (R)
     // ---------
     // ---------
@@ -605,8 +604,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##----###
     // ---------
     // ---------
-    0x02, 0xF8, 0x04, 0x18, 0x02, 0xF0, 0x81, 0x00, 0x02, 0x3F, 0x02, 0x03, 0x85, 0x07, 0x0D, 0x39,
-    0x30, 0x20,
+    0x00, 0x07, 0x00, 0x10, 0x82, 0x0F, 0x00, 0x00, 0x05, 0x00, 0x66, 0x84, 0xB0, 0x9C, 0x0C, 0x04,
     // Character 83 (0x53) (S)
     // ---------
     // ---------
@@ -624,8 +622,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x02, 0xF0, 0x03, 0x98, 0x81, 0x18, 0x02, 0x30, 0x83, 0x00, 0x08, 0x18, 0x03, 0x31, 0x84, 0x33,
-    0x1F, 0x1E, 0x00,
+    0x02, 0x0F, 0x03, 0x19, 0x81, 0x18, 0x02, 0x0C, 0x83, 0x00, 0x10, 0x18, 0x03, 0x8C, 0x84, 0xCC,
+    0xF8, 0x78, 0x00,
     // Character 84 (0x54) (T)
     // ---------
     // ---------
@@ -643,7 +641,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ---##----
     // ---------
     // ---------
-    0x03, 0x18, 0x02, 0xF8, 0x03, 0x18, 0x04, 0x00, 0x02, 0x3F, 0x04, 0x00,
+    0x00, 0x09, 0x00, 0x98, 0x03, 0x00, 0x02, 0xFC, 0x04, 0x00,
     // Character 85 (0x55) (U)
     // ---------
     // ---------
@@ -661,7 +659,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // --####---
     // ---------
     // ---------
-    0x02, 0xF8, 0x04, 0x00, 0x02, 0xF8, 0x83, 0x00, 0x0F, 0x1F, 0x03, 0x30, 0x84, 0x38, 0x1F, 0x0F,
+    0x02, 0x1F, 0x04, 0x00, 0x02, 0x1F, 0x83, 0x00, 0xF0, 0xF8, 0x03, 0x0C, 0x84, 0x1C, 0xF8, 0xF0,
     0x00,
     // Character 90 (0x5A) (Z)
     // ---------
@@ -680,8 +678,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x81, 0x00, 0x03, 0x18, 0x8A, 0xD8, 0xF8, 0x78, 0x18, 0x00, 0x30, 0x3C, 0x3E, 0x37, 0x31, 0x03,
-    0x30, 0x01, 0x00,
+    0x81, 0x00, 0x03, 0x18, 0x8A, 0x1B, 0x1F, 0x1E, 0x18, 0x00, 0x0C, 0x3C, 0x7C, 0xEC, 0x8C, 0x03,
+    0x0C, 0x01, 0x00,
     // Character 97 (0x61) (a)
     // ----------
     // ----------
@@ -699,8 +697,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // -####--##-
     // ----------
     // ----------
-    0x82, 0x80, 0xC0, 0x04, 0x60, 0x82, 0xE0, 0xC0, 0x02, 0x00, 0x82, 0x1E, 0x3E, 0x03, 0x33, 0x85,
-    0x1B, 0x1F, 0x3F, 0x30, 0x00,
+    0x82, 0x01, 0x03, 0x04, 0x06, 0x82, 0x07, 0x03, 0x02, 0x00, 0x82, 0x78, 0x7C, 0x03, 0xCC, 0x85,
+    0xD8, 0xF8, 0xFC, 0x0C, 0x00,
     // Character 104 (0x68) (h)
     // ---------
     // ---------
@@ -718,7 +716,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##----##-
     // ---------
     // ---------
-    0x02, 0xFC, 0x81, 0xC0, 0x03, 0x60, 0x83, 0xE0, 0xC0, 0x00, 0x02, 0x3F, 0x04, 0x00, 0x02, 0x3F,
+    0x02, 0x3F, 0x81, 0x03, 0x03, 0x06, 0x83, 0x07, 0x03, 0x00, 0x02, 0xFC, 0x04, 0x00, 0x02, 0xFC,
     0x01, 0x00,
     // Character 105 (0x69) (i)
     // ---------
@@ -737,7 +735,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ########-
     // ---------
     // ---------
-    0x81, 0x00, 0x02, 0x60, 0x02, 0xEC, 0x04, 0x00, 0x03, 0x30, 0x02, 0x3F, 0x03, 0x30, 0x01, 0x00,
+    0x81, 0x00, 0x02, 0x06, 0x02, 0x37, 0x00, 0x0D, 0x02, 0x0F,
     // Character 109 (0x6D) (m)
     // ---------
     // ---------
@@ -755,8 +753,8 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##-##-##-
     // ---------
     // ---------
-    0x02, 0xE0, 0x87, 0x60, 0xE0, 0xC0, 0x60, 0xE0, 0xC0, 0x00, 0x02, 0x3F, 0x81, 0x00, 0x02, 0x3F,
-    0x81, 0x00, 0x02, 0x3F, 0x01, 0x00,
+    0x02, 0x07, 0x84, 0x06, 0x07, 0x03, 0x06, 0x00, 0x06, 0x00, 0x1D, 0x02, 0xFC, 0x81, 0x00, 0x02,
+    0xFC, 0x01, 0x00,
     // Character 110 (0x6E) (n)
     // ---------
     // ---------
@@ -774,8 +772,7 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##----##-
     // ---------
     // ---------
-    0x02, 0xE0, 0x81, 0xC0, 0x03, 0x60, 0x83, 0xE0, 0xC0, 0x00, 0x02, 0x3F, 0x04, 0x00, 0x02, 0x3F,
-    0x01, 0x00,
+    0x02, 0x07, 0x00, 0x10, 0x00, 0x2F,
     // Character 120 (0x78) (x)
     // ---------
     // ---------
@@ -793,6 +790,6 @@ const uint8_t pressure_font[] PROGMEM = {
     // ##----##-
     // ---------
     // ---------
-    0x83, 0x20, 0x60, 0xE0, 0x02, 0x80, 0x87, 0xE0, 0x60, 0x20, 0x00, 0x20, 0x38, 0x1D, 0x02, 0x07,
-    0x84, 0x1D, 0x38, 0x20, 0x00,
+    0x83, 0x04, 0x06, 0x07, 0x02, 0x01, 0x87, 0x07, 0x06, 0x04, 0x00, 0x04, 0x1C, 0xB8, 0x02, 0xE0,
+    0x84, 0xB8, 0x1C, 0x04, 0x00,
 };
@@ -3,11 +3,47 @@
 #include <data/stream_u16_to_u8.h>
 #include <oledm/graph_display.h>
 
+#if PRESSURE_GRAPH_COLS > STREAM_U16_TO_U8_MAX_POINTS
+#error PRESSURE_GRAPH_COLS is more than STREAM_U16_TO_U8_MAX_POINTS
+#endif
+
+// The graph axis moves in steps of 1 hPa (10 measurement units) so that
+// small changes to the min and max do not reshape the whole graph.  0
+// follows the min and max exactly.
+#ifndef PRESSURE_GRAPH_AXIS_STEP
+#define PRESSURE_GRAPH_AXIS_STEP 10
+#endif
+
+// One of GRAPH_DISPLAY_LINE, GRAPH_DISPLAY_ENVELOPE or GRAPH_DISPLAY_FILLED.
+// The envelope shows the lowest and highest of the one minute samples
+// behind each 10 minute point, which takes another PRESSURE_GRAPH_COLS
+// bytes.
+#ifndef PRESSURE_GRAPH_MODE
+#define PRESSURE_GRAPH_MODE GRAPH_DISPLAY_LINE
+#endif
+
+// Entries in each of the min and max trackers.  A steady rise or fall
+// longer than this makes the stream scan its window again every time a
+// point drops out of it (see StreamU16ToU8Tracker).  PRESSURE_GRAPH_COLS
+// never scans but takes that many bytes per tracker.
+#ifndef PRESSURE_GRAPH_TRACKER_SIZE
+#define PRESSURE_GRAPH_TRACKER_SIZE 16
+#endif
+
 struct GraphDisplay gd;
 struct StreamU16ToU8 stream;
 
-uint8_t graph_data[PRESSURE_GRAPH_COLS];
 uint16_t pressure_data[PRESSURE_GRAPH_COLS];
+stream_index_t min_index[PRESSURE_GRAPH_TRACKER_SIZE];
+stream_index_t max_index[PRESSURE_GRAPH_TRACKER_SIZE];
+uint16_t version;
+
+#if PRESSURE_GRAPH_MODE == GRAPH_DISPLAY_ENVELOPE
+uint8_t pressure_spread[PRESSURE_GRAPH_COLS];
+// Lowest and highest sample since the last point
+uint16_t sample_min = 0xFFFF;
+uint16_t sample_max;
+#endif
 
 // Converts a 32-bit pa value to a 16-bit "measurement" which
 // had a narrower range and lower resolution but also requires
@@ -29,17 +65,45 @@ uint8_t every6(column_t column) {
   return (column % 6) == 0 ? 3 : 0;
 }
 
+// This is a GraphDisplay callback for the data.  Points are scaled
+// as the graph is drawn instead of keeping a scaled copy of pressure_data,
+// so nothing is scaled while the graph is not shown.
+static uint8_t graph_value(column_t column) {
+  return stream_u16_to_u8_value(&stream, column);
+}
+
+#if PRESSURE_GRAPH_MODE == GRAPH_DISPLAY_ENVELOPE
+// This is a GraphDisplay callback for the envelope.
+static struct GraphRange graph_range(column_t column) {
+  struct GraphRange range;
+  stream_u16_to_u8_range(&stream, column, &range.low, &range.high);
+  return range;
+}
+#endif
+
 // Called at startup to initialize everyting.
 void pressure_graph_init(struct OLEDM* display) {
   graph_display_init(
-      &gd, display, PRESSURE_GRAPH_COLS, PRESSURE_GRAPH_ROWS, graph_data);
+      &gd, display, PRESSURE_GRAPH_COLS, PRESSURE_GRAPH_ROWS, 0);
   gd.ticmark_callback = every6;
+  gd.data_callback = graph_value;
+  gd.mode = PRESSURE_GRAPH_MODE;
+#if PRESSURE_GRAPH_MODE == GRAPH_DISPLAY_ENVELOPE
+  gd.range_callback = graph_range;
+#endif
   stream_u16_to_u8_init(
       &stream,
       PRESSURE_GRAPH_COLS,
       PRESSURE_GRAPH_ROWS * 8,
       pressure_data,
-      graph_data);
+      0,
+      min_index,
+      max_index);
+  stream.axis_step = PRESSURE_GRAPH_AXIS_STEP;
+  stream.index_size = PRESSURE_GRAPH_TRACKER_SIZE;
+#if PRESSURE_GRAPH_MODE == GRAPH_DISPLAY_ENVELOPE
+  stream.spread = pressure_spread;
+#endif
 }
 
 // Returns true if any data has been added to the graph.
@@ -47,9 +111,36 @@ uint8_t pressure_graph_has_data(void) {
   return stream.head || stream.wrapped;
 }
 
+void pressure_graph_add_sample(uint32_t pressure_pa) {
+#if PRESSURE_GRAPH_MODE == GRAPH_DISPLAY_ENVELOPE
+  const uint16_t m = pa_to_measurement(pressure_pa);
+  if (m < sample_min) {
+    sample_min = m;
+  }
+  if (m > sample_max) {
+    sample_max = m;
+  }
+#else
+  (void)pressure_pa;
+#endif
+}
+
 // Adds one pressure point to the graph
 void pressure_graph_add_point(uint32_t pressure_pa) {
-  stream_u16_to_u8_add_point(&stream, pa_to_measurement(pressure_pa));
+  const uint16_t m = pa_to_measurement(pressure_pa);
+#if PRESSURE_GRAPH_MODE == GRAPH_DISPLAY_ENVELOPE
+  // The samples are the same as the point when there are none
+  stream_u16_to_u8_add_range(
+      &stream,
+      m,
+      sample_min < m ? sample_min : m,
+      sample_max > m ? sample_max : m);
+  sample_min = 0xFFFF;
+  sample_max = 0;
+#else
+  stream_u16_to_u8_add_point(&stream, m);
+#endif
+  ++version;
 }
 
 // Returns the maximum pressure available in the graph.
@@ -64,10 +155,14 @@ uint32_t pressure_graph_min_pa(void) {
   return measurement_to_pa(stream.min);
 }
 
+uint16_t pressure_graph_version(void) {
+  return version;
+}
+
 void pressure_graph_plot(void) {
   // we want head to represent the end of the plot
   gd.column_offset = stream.head;
-  graph_display_render(&gd, 0, PRESSURE_GRAPH_FIRST_ROW);
+  graph_display_render_columns(&gd, 0, PRESSURE_GRAPH_FIRST_ROW);
 }
 
 
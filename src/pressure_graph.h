@@ -12,6 +12,13 @@
 
 void pressure_graph_init(struct OLEDM* display);
 
+// Called for every pressure reading.  Only used by the envelope mode (see
+// PRESSURE_GRAPH_MODE), which shows the range of readings behind each
+// point.
+void pressure_graph_add_sample(uint32_t pressure_pa);
+
+// Adds a point to the graph.  The readings given to
+// pressure_graph_add_sample() since the last point go with it.
 void pressure_graph_add_point(uint32_t pressure_pa);
 
 // Returns true if the pressure graph has any data stored in it
@@ -23,6 +30,10 @@ uint32_t pressure_graph_max_pa(void);
 // Returns the minimum pressure in the last PRESSURE_GRAPH_COLS samples
 uint32_t pressure_graph_min_pa(void);
 
+// Returns a value that changes whenever a point is added.  Used to tell
+// if the graph needs to be redrawn.
+uint16_t pressure_graph_version(void);
+
 // plot pressure graph to the display
 void pressure_graph_plot(void);
 
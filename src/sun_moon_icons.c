@@ -0,0 +1,473 @@
+// Generated font data for sun_moon_icons
+
+#include <inttypes.h>
+#include <avr/pgmspace.h> 
+
+const uint8_t sun_moon_icons[] PROGMEM = {
+    0x56, 0x41, 0x52, 0x32,  // id: VAR2
+    0x12, // num_chars
+    0x83, // height | VARIABLE_FONT_REVERSED
+
+    // Character offsets
+    0, 24, 0x00, 0x48,  // off=72
+    1, 24, 0x00, 0x8D,  // off=141
+    2, 24, 0x00, 0xB1,  // off=177
+    3, 24, 0x00, 0xCC,  // off=204
+    4, 24, 0x00, 0xEE,  // off=238
+    5, 24, 0x01, 0x10,  // off=272
+    6, 24, 0x01, 0x34,  // off=308
+    7, 24, 0x01, 0x54,  // off=340
+    8, 24, 0x01, 0x72,  // off=370
+    9, 24, 0x01, 0x83,  // off=387
+    10, 24, 0x01, 0x10,  // off=272 (shared)
+    11, 24, 0x01, 0xAC,  // off=428
+    12, 24, 0x01, 0xD0,  // off=464
+    13, 24, 0x01, 0xEE,  // off=494
+    14, 24, 0x00, 0x8D,  // off=141 (shared)
+    15, 24, 0x02, 0x0D,  // off=525
+    16, 24, 0x02, 0x2D,  // off=557
+    17, 24, 0x02, 0x4D,  // off=589
+    // Character data
+    // Character 0 (0x00)
+    // ----------##------------
+    // -----#----##----#-------
+    // -----##---##---##-------
+    // ------##########--------
+    // ------##------##--------
+    // -##--##--------##--##---
+    // --####----------####----
+    // ---##------------##-----
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ####--------------####--
+    // ####--------------####--
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ---##------------##-----
+    // --####----------####----
+    // -##--##--------##--##---
+    // ------##------##--------
+    // ------##########--------
+    // -----##---##---##-------
+    // -----#----##----#-------
+    // ----------##------------
+    // ------------------------
+    // ------------------------
+    0x83, 0x00, 0x04, 0x06, 0x02, 0x03, 0x83, 0x66, 0x3C, 0x18, 0x02, 0x10, 0x02, 0xF0, 0x02, 0x10,
+    0x83, 0x18, 0x3C, 0x66, 0x02, 0x03, 0x82, 0x06, 0x04, 0x03, 0x00, 0x02, 0x30, 0x84, 0x31, 0xFF,
+    0x03, 0x01, 0x0A, 0x00, 0x84, 0x01, 0x03, 0xFF, 0x31, 0x02, 0x30, 0x03, 0x00, 0x02, 0x80, 0x02,
+    0x00, 0x83, 0x98, 0xF0, 0x60, 0x02, 0x20, 0x02, 0x3C, 0x02, 0x20, 0x83, 0x60, 0xF0, 0x98, 0x02,
+    0x00, 0x02, 0x80, 0x03, 0x00,
+    // Character 1 (0x01)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##########--------
+    // -----############-------
+    // ----##############------
+    // ----##############------
+    // ---################-----
+    // ---################-----
+    // ---################-----
+    // ---################-----
+    // ---################-----
+    // ---################-----
+    // ----##############------
+    // ----##############------
+    // -----############-------
+    // ------##########--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x04, 0x00, 0x82, 0x03, 0x07, 0x02, 0x0F, 0x06, 0x1F, 0x02, 0x0F, 0x82, 0x07, 0x03, 0x09, 0x00,
+    0x81, 0xFC, 0x0E, 0xFF, 0x81, 0xFC, 0x0A, 0x00, 0x81, 0x80, 0x02, 0xC0, 0x06, 0xE0, 0x02, 0xC0,
+    0x81, 0x80, 0x07, 0x00,
+    // Character 2 (0x02)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##########--------
+    // -----############-------
+    // ----###########-##------
+    // ---############--#------
+    // ---############---#-----
+    // ---############---#-----
+    // --#############---#-----
+    // --#############---#-----
+    // ---############---#-----
+    // ---############---#-----
+    // ---############--#------
+    // ----###########-##------
+    // -----############-------
+    // ------##########--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x03, 0x00, 0x01, 0x01, 0x00, 0x0B, 0x00, 0x26, 0x83, 0x0C, 0x06, 0x03, 0x08, 0x00, 0x82, 0x30,
+    0xFE, 0x0B, 0xFF, 0x83, 0x00, 0x01, 0x03, 0x00, 0x1E, 0x00, 0x27,
+    // Character 3 (0x03)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------######--##--------
+    // -----#######---##-------
+    // ----########----##------
+    // ----########-----#------
+    // ---#########------#-----
+    // ---#########------#-----
+    // ---#########------#-----
+    // ---#########------#-----
+    // ---#########------#-----
+    // ---#########------#-----
+    // ----########-----#------
+    // ----########----##------
+    // -----#######---##-------
+    // ------######--##--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x0C, 0x00, 0x3F, 0x02, 0x10, 0x01, 0x08, 0x00, 0x0B, 0x00, 0x1B, 0x82, 0x00, 0xFC, 0x08,
+    0xFF, 0x04, 0x00, 0x82, 0x01, 0x03, 0x00, 0x12, 0x00, 0x41, 0x02, 0x20, 0x83, 0x40, 0xC0, 0x80,
+    0x07, 0x00,
+    // Character 4 (0x04)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------####----##--------
+    // -----#####-----##-------
+    // ----#####-------##------
+    // ----#####--------#------
+    // ---######---------#-----
+    // ---######---------#-----
+    // ---######---------#-----
+    // ---######---------#-----
+    // ---######---------#-----
+    // ---######---------#-----
+    // ----#####--------#------
+    // ----#####-------##------
+    // -----#####-----##-------
+    // ------####----##--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x09, 0x00, 0x61, 0x81, 0x1C, 0x04, 0x10, 0x01, 0x08, 0x00, 0x0B, 0x00, 0x3F, 0x00, 0x07,
+    0x00, 0x24, 0x03, 0x00, 0x00, 0x06, 0x00, 0x25, 0x00, 0x10, 0x00, 0x65, 0x02, 0x20, 0x00, 0x0C,
+    0x00, 0x26,
+    // Character 5 (0x05)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##------##--------
+    // -----##--------##-------
+    // ----##----------##------
+    // ----#------------#------
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ---#--------------#-----
+    // ----#------------#------
+    // ----##----------##------
+    // -----##--------##-------
+    // ------##------##--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x04, 0x00, 0x84, 0x03, 0x06, 0x0C, 0x08, 0x06, 0x10, 0x01, 0x08, 0x00, 0x0B, 0x00, 0x62, 0x84,
+    0x00, 0xFC, 0x03, 0x01, 0x00, 0x0C, 0x00, 0xBA, 0x00, 0x0D, 0x00, 0x87, 0x81, 0x40, 0x04, 0x20,
+    0x00, 0x0C, 0x00, 0x4A,
+    // Character 6 (0x06)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##----####--------
+    // -----##-----#####-------
+    // ----##-------#####------
+    // ----#--------#####------
+    // ---#---------######-----
+    // ---#---------######-----
+    // ---#---------######-----
+    // ---#---------######-----
+    // ---#---------######-----
+    // ---#---------######-----
+    // ----#--------#####------
+    // ----##-------#####------
+    // -----##-----#####-------
+    // ------##----####--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x0C, 0x00, 0x24, 0x82, 0x1C, 0x1F, 0x00, 0x0E, 0x00, 0xA5, 0x82, 0x03, 0x01, 0x07, 0x00,
+    0x05, 0xFF, 0x00, 0x0D, 0x00, 0xA5, 0x81, 0x40, 0x04, 0x20, 0x02, 0xE0, 0x00, 0x0A, 0x00, 0xA5,
+    // Character 7 (0x07)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##--######--------
+    // -----##---#######-------
+    // ----##----########------
+    // ----#-----########------
+    // ---#------#########-----
+    // ---#------#########-----
+    // ---#------#########-----
+    // ---#------#########-----
+    // ---#------#########-----
+    // ---#------#########-----
+    // ----#-----########------
+    // ----##----########------
+    // -----##---#######-------
+    // ------##--######--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x0A, 0x00, 0x44, 0x04, 0x1F, 0x00, 0x0E, 0x00, 0xC4, 0x00, 0x06, 0x00, 0x1F, 0x08, 0xFF,
+    0x00, 0x0D, 0x00, 0xC3, 0x81, 0x40, 0x02, 0x20, 0x04, 0xE0, 0x00, 0x0A, 0x00, 0xC3,
+    // Character 8 (0x08)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##########--------
+    // -----############-------
+    // ----##############------
+    // ----#-############------
+    // ---#--#############-----
+    // ---#--#############-----
+    // ---#--#############-----
+    // ---#--#############-----
+    // ---#--#############-----
+    // ---#--#############-----
+    // ----#-############------
+    // ----##############------
+    // -----############-------
+    // ------##########--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x06, 0x00, 0x62, 0x00, 0x16, 0x00, 0xE4, 0x82, 0x03, 0x01, 0x0C, 0xFF, 0x00, 0x1E, 0x00,
+    0xDE,
+    // Character 9 (0x09)
+    // ----------##------------
+    // -----#----##----#-------
+    // -----##---##---##-------
+    // ------##########--------
+    // ------##########--------
+    // -##--############--##---
+    // --##################----
+    // ---################-----
+    // ---################-----
+    // ---################-----
+    // ######################--
+    // ######################--
+    // ---################-----
+    // ---################-----
+    // ---################-----
+    // --##################----
+    // -##--############--##---
+    // ------##########--------
+    // ------##########--------
+    // -----##---##---##-------
+    // -----#----##----#-------
+    // ----------##------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x05, 0x01, 0x3B, 0x82, 0x67, 0x3F, 0x03, 0x1F, 0x02, 0xFF, 0x03, 0x1F, 0x82, 0x3F, 0x67,
+    0x00, 0x0B, 0x01, 0x37, 0x0F, 0xFF, 0x01, 0x31, 0x00, 0x0B, 0x01, 0x2A, 0x03, 0xE0, 0x02, 0xFC,
+    0x03, 0xE0, 0x82, 0xF0, 0x98, 0x00, 0x07, 0x01, 0x21,
+    // Character 11 (0x0B)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##------##--------
+    // -----#---------##-------
+    // ----#----------###------
+    // ----#----------###------
+    // ---#-----------####-----
+    // ---#-----------####-----
+    // ---#-----------####-----
+    // ---#-----------####-----
+    // ---#-----------####-----
+    // ---#-----------####-----
+    // ----#----------###------
+    // ----##---------###------
+    // -----#---------##-------
+    // ------##------##--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x04, 0x00, 0x82, 0x03, 0x04, 0x02, 0x08, 0x06, 0x10, 0x82, 0x08, 0x0F, 0x00, 0x0C, 0x01, 0x20,
+    0x00, 0x09, 0x00, 0x7D, 0x02, 0x00, 0x03, 0xFF, 0x00, 0x0C, 0x01, 0x23, 0x02, 0x40, 0x04, 0x20,
+    0x00, 0x0C, 0x00, 0xE6,
+    // Character 12 (0x0C)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##---#####--------
+    // -----##----######-------
+    // ----##-----#######------
+    // ----#------#######------
+    // ---#-------########-----
+    // ---#-------########-----
+    // ---#-------########-----
+    // ---#-------########-----
+    // ---#-------########-----
+    // ---#-------########-----
+    // ----#------#######------
+    // ----##-----#######------
+    // -----##----######-------
+    // ------##---#####--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x0B, 0x00, 0xC0, 0x03, 0x1F, 0x00, 0x0E, 0x01, 0x40, 0x00, 0x07, 0x00, 0x9B, 0x07, 0xFF,
+    0x00, 0x0D, 0x01, 0x3F, 0x81, 0x40, 0x03, 0x20, 0x03, 0xE0, 0x00, 0x0A, 0x01, 0x3F,
+    // Character 13 (0x0D)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##########--------
+    // -----##--########-------
+    // ----##--##########------
+    // ----#---##########------
+    // ---#----###########-----
+    // ---#----###########-----
+    // ---#----###########-----
+    // ---#----###########-----
+    // ---#----###########-----
+    // ---#----###########-----
+    // ----#---##########------
+    // ----##--##########------
+    // -----##--########-------
+    // ------##########--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x08, 0x00, 0xDE, 0x81, 0x1B, 0x05, 0x1F, 0x00, 0x0E, 0x01, 0x60, 0x00, 0x04, 0x00, 0xBB,
+    0x0A, 0xFF, 0x00, 0x0D, 0x01, 0x5F, 0x82, 0x40, 0x60, 0x05, 0xE0, 0x00, 0x0A, 0x01, 0x5E,
+    // Character 15 (0x0F)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##########--------
+    // -----########--##-------
+    // ----##########--##------
+    // ----##########---#------
+    // ---###########----#-----
+    // ---###########----#-----
+    // ---###########----#-----
+    // ---###########----#-----
+    // ---###########----#-----
+    // ---###########----#-----
+    // ----##########---#------
+    // ----##########--##------
+    // -----########--##-------
+    // ------##########--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x0D, 0x01, 0x80, 0x82, 0x1B, 0x08, 0x00, 0x0B, 0x01, 0x5B, 0x00, 0x0A, 0x01, 0x40, 0x02,
+    0xFF, 0x02, 0x00, 0x82, 0x01, 0x03, 0x00, 0x13, 0x01, 0x82, 0x01, 0x60, 0x00, 0x0A, 0x01, 0x41,
+    // Character 16 (0x10)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------#####---##--------
+    // -----######----##-------
+    // ----#######-----##------
+    // ----#######------#------
+    // ---########-------#-----
+    // ---########-------#-----
+    // ---########-------#-----
+    // ---########-------#-----
+    // ---########-------#-----
+    // ---########-------#-----
+    // ----#######------#------
+    // ----#######-----##------
+    // -----######----##-------
+    // ------#####---##--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x0B, 0x01, 0xA0, 0x03, 0x10, 0x01, 0x08, 0x00, 0x0B, 0x01, 0x7C, 0x00, 0x09, 0x01, 0x61,
+    0x01, 0x00, 0x00, 0x06, 0x01, 0x62, 0x00, 0x11, 0x01, 0xA2, 0x01, 0x20, 0x00, 0x0C, 0x01, 0x63,
+    // Character 17 (0x11)
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // --------######----------
+    // ------##------##--------
+    // -----#---------##-------
+    // ----##----------##------
+    // ----##-----------#------
+    // ---###------------#-----
+    // ---###------------#-----
+    // ---####-----------#-----
+    // ---####-----------#-----
+    // ---###------------#-----
+    // ---###-----------##-----
+    // ----##-----------#------
+    // ----##----------##------
+    // -----##--------##-------
+    // ------##-----###--------
+    // --------######----------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    // ------------------------
+    0x00, 0x06, 0x01, 0xC0, 0x00, 0x09, 0x00, 0xA0, 0x00, 0x0B, 0x01, 0x9C, 0x00, 0x04, 0x01, 0x81,
+    0x81, 0x30, 0x09, 0x00, 0x82, 0x01, 0x07, 0x00, 0x0D, 0x01, 0xC3, 0x81, 0x40, 0x05, 0x20, 0x01,
+    0x60, 0x00, 0x0A, 0x01, 0x86,
+};
@@ -0,0 +1,10 @@
+#ifndef SUN_MOON_ICONS_H
+#define SUN_MOON_ICONS_H
+// Generated font data for sun_moon_icons.yaml
+
+#include <inttypes.h>
+#include <avr/pgmspace.h>
+
+extern const uint8_t sun_moon_icons[] PROGMEM;
+
+#endif  // SUN_MOON_ICONS_H
@@ -1,275 +0,0 @@
-// Generated font data for sun_moon_icons_dark
-
-#include <inttypes.h>
-#include <avr/pgmspace.h> 
-
-const uint8_t sun_moon_icons_dark[] PROGMEM = {
-    0x56, 0x41, 0x52, 0x31,  // id: VAR1
-    0x09, // num_chars
-    0x03, // height
-
-    // Character offsets
-    0, 24, 0x00, 0x24,  // off=36
-    1, 24, 0x00, 0x5F,  // off=95
-    2, 24, 0x00, 0x87,  // off=135
-    3, 24, 0x00, 0xAF,  // off=175
-    4, 24, 0x00, 0xDB,  // off=219
-    5, 24, 0x01, 0x05,  // off=261
-    6, 24, 0x01, 0x29,  // off=297
-    7, 24, 0x01, 0x53,  // off=339
-    8, 24, 0x01, 0x7F,  // off=383
-    // Character data
-    // Character 0 (0x00)
-    // ----------##------------
-    // -----#----##----#-------
-    // -----##---##---##-------
-    // ------##########--------
-    // ------##########--------
-    // -##--############--##---
-    // --##################----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ######################--
-    // ######################--
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // --##################----
-    // -##--############--##---
-    // ------##########--------
-    // ------##########--------
-    // -----##---##---##-------
-    // -----#----##----#-------
-    // ----------##------------
-    // ------------------------
-    // ------------------------
-    0x83, 0x00, 0x20, 0x60, 0x02, 0xC0, 0x82, 0xE6, 0xFC, 0x03, 0xF8, 0x02, 0xFF, 0x03, 0xF8, 0x82,
-    0xFC, 0xE6, 0x02, 0xC0, 0x82, 0x60, 0x20, 0x03, 0x00, 0x02, 0x0C, 0x81, 0x8C, 0x10, 0xFF, 0x81,
-    0x8C, 0x02, 0x0C, 0x03, 0x00, 0x02, 0x01, 0x02, 0x00, 0x82, 0x19, 0x0F, 0x03, 0x07, 0x02, 0x3F,
-    0x03, 0x07, 0x82, 0x0F, 0x19, 0x02, 0x00, 0x02, 0x01, 0x03, 0x00,
-    // Character 1 (0x01)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##------##--------
-    // -----##--------##-------
-    // ----##----------##------
-    // ----#------------#------
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ----#------------#------
-    // ----##----------##------
-    // -----##--------##-------
-    // ------##------##--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x84, 0xC0, 0x60, 0x30, 0x10, 0x06, 0x08, 0x84, 0x10, 0x30, 0x60, 0xC0, 0x09, 0x00,
-    0x83, 0x3F, 0xC0, 0x80, 0x0A, 0x00, 0x83, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x83, 0x01, 0x03, 0x02,
-    0x06, 0x04, 0x83, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 2 (0x02)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##------##--------
-    // -----#---------##-------
-    // ----#----------###------
-    // ----#----------###------
-    // ---#-----------####-----
-    // ---#-----------####-----
-    // ---#-----------####-----
-    // ---#-----------####-----
-    // ---#-----------####-----
-    // ---#-----------####-----
-    // ----#----------###------
-    // ----##---------###------
-    // -----#---------##-------
-    // ------##------##--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0x20, 0x02, 0x10, 0x06, 0x08, 0x84, 0x10, 0xF0, 0xE0, 0xC0, 0x09, 0x00,
-    0x83, 0x3F, 0xC0, 0x80, 0x09, 0x00, 0x03, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x81, 0x01, 0x02, 0x02,
-    0x06, 0x04, 0x83, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 3 (0x03)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##---#####--------
-    // -----##----######-------
-    // ----##-----#######------
-    // ----#------#######------
-    // ---#-------########-----
-    // ---#-------########-----
-    // ---#-------########-----
-    // ---#-------########-----
-    // ---#-------########-----
-    // ---#-------########-----
-    // ----#------#######------
-    // ----##-----#######------
-    // -----##----######-------
-    // ------##---#####--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x84, 0xC0, 0x60, 0x30, 0x10, 0x03, 0x08, 0x03, 0xF8, 0x02, 0xF0, 0x82, 0xE0, 0xC0,
-    0x09, 0x00, 0x83, 0x3F, 0xC0, 0x80, 0x05, 0x00, 0x07, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x83, 0x01,
-    0x03, 0x02, 0x03, 0x04, 0x03, 0x07, 0x02, 0x03, 0x81, 0x01, 0x07, 0x00,
-    // Character 4 (0x04)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##########--------
-    // -----##--########-------
-    // ----##--##########------
-    // ----#---##########------
-    // ---#----###########-----
-    // ---#----###########-----
-    // ---#----###########-----
-    // ---#----###########-----
-    // ---#----###########-----
-    // ---#----###########-----
-    // ----#---##########------
-    // ----##--##########------
-    // -----##--########-------
-    // ------##########--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x85, 0xC0, 0x60, 0x30, 0x10, 0xD8, 0x05, 0xF8, 0x02, 0xF0, 0x82, 0xE0, 0xC0, 0x09,
-    0x00, 0x83, 0x3F, 0xC0, 0x80, 0x02, 0x00, 0x0A, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x84, 0x01, 0x03,
-    0x02, 0x06, 0x05, 0x07, 0x02, 0x03, 0x81, 0x01, 0x07, 0x00,
-    // Character 5 (0x05)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##########--------
-    // -----############-------
-    // ----##############------
-    // ----##############------
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ----##############------
-    // ----##############------
-    // -----############-------
-    // ------##########--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0xF0, 0x06, 0xF8, 0x02, 0xF0, 0x82, 0xE0, 0xC0, 0x09, 0x00,
-    0x81, 0x3F, 0x0E, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x81, 0x01, 0x02, 0x03, 0x06, 0x07, 0x02, 0x03,
-    0x81, 0x01, 0x07, 0x00,
-    // Character 6 (0x06)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##########--------
-    // -----########--##-------
-    // ----##########--##------
-    // ----##########---#------
-    // ---###########----#-----
-    // ---###########----#-----
-    // ---###########----#-----
-    // ---###########----#-----
-    // ---###########----#-----
-    // ---###########----#-----
-    // ----##########---#------
-    // ----##########--##------
-    // -----########--##-------
-    // ------##########--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0xF0, 0x05, 0xF8, 0x85, 0xD8, 0x10, 0x30, 0x60, 0xC0, 0x09,
-    0x00, 0x81, 0x3F, 0x0A, 0xFF, 0x02, 0x00, 0x83, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x81, 0x01, 0x02,
-    0x03, 0x05, 0x07, 0x84, 0x06, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 7 (0x07)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------#####---##--------
-    // -----######----##-------
-    // ----#######-----##------
-    // ----#######------#------
-    // ---########-------#-----
-    // ---########-------#-----
-    // ---########-------#-----
-    // ---########-------#-----
-    // ---########-------#-----
-    // ---########-------#-----
-    // ----#######------#------
-    // ----#######-----##------
-    // -----######----##-------
-    // ------#####---##--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0xF0, 0x03, 0xF8, 0x03, 0x08, 0x84, 0x10, 0x30, 0x60, 0xC0,
-    0x09, 0x00, 0x81, 0x3F, 0x07, 0xFF, 0x05, 0x00, 0x83, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x81, 0x01,
-    0x02, 0x03, 0x03, 0x07, 0x03, 0x04, 0x83, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 8 (0x08)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##------##--------
-    // -----#---------##-------
-    // ----##----------##------
-    // ----##-----------#------
-    // ---###------------#-----
-    // ---###------------#-----
-    // ---####-----------#-----
-    // ---####-----------#-----
-    // ---###------------#-----
-    // ---###-----------##-----
-    // ----##-----------#------
-    // ----##----------##------
-    // -----##--------##-------
-    // ------##-----###--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0x10, 0x06, 0x08, 0x84, 0x10, 0x30, 0x60, 0xC0, 0x09, 0x00,
-    0x81, 0x3F, 0x02, 0xFF, 0x81, 0x0C, 0x09, 0x00, 0x83, 0x80, 0xE0, 0x3F, 0x0A, 0x00, 0x83, 0x01,
-    0x03, 0x02, 0x05, 0x04, 0x84, 0x06, 0x02, 0x03, 0x01, 0x07, 0x00,
-};
@@ -1,10 +0,0 @@
-#ifndef SUN_MOON_ICONS_DARK_H
-#define SUN_MOON_ICONS_DARK_H
-// Generated font data for sun_moon_icons_dark.yaml
-
-#include <inttypes.h>
-#include <avr/pgmspace.h>
-
-extern const uint8_t sun_moon_icons_dark[] PROGMEM;
-
-#endif  // SUN_MOON_ICONS_DARK_H
@@ -1,276 +0,0 @@
-// Generated font data for sun_moon_icons_light
-
-#include <inttypes.h>
-#include <avr/pgmspace.h> 
-
-const uint8_t sun_moon_icons_light[] PROGMEM = {
-    0x56, 0x41, 0x52, 0x31,  // id: VAR1
-    0x09, // num_chars
-    0x03, // height
-
-    // Character offsets
-    0, 24, 0x00, 0x24,  // off=36
-    1, 24, 0x00, 0x69,  // off=105
-    2, 24, 0x00, 0x8D,  // off=141
-    3, 24, 0x00, 0xB6,  // off=182
-    4, 24, 0x00, 0xE2,  // off=226
-    5, 24, 0x01, 0x0F,  // off=271
-    6, 24, 0x01, 0x37,  // off=311
-    7, 24, 0x01, 0x64,  // off=356
-    8, 24, 0x01, 0x90,  // off=400
-    // Character data
-    // Character 0 (0x00)
-    // ----------##------------
-    // -----#----##----#-------
-    // -----##---##---##-------
-    // ------##########--------
-    // ------##------##--------
-    // -##--##--------##--##---
-    // --####----------####----
-    // ---##------------##-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ####--------------####--
-    // ####--------------####--
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---##------------##-----
-    // --####----------####----
-    // -##--##--------##--##---
-    // ------##------##--------
-    // ------##########--------
-    // -----##---##---##-------
-    // -----#----##----#-------
-    // ----------##------------
-    // ------------------------
-    // ------------------------
-    0x83, 0x00, 0x20, 0x60, 0x02, 0xC0, 0x83, 0x66, 0x3C, 0x18, 0x02, 0x08, 0x02, 0x0F, 0x02, 0x08,
-    0x83, 0x18, 0x3C, 0x66, 0x02, 0xC0, 0x82, 0x60, 0x20, 0x03, 0x00, 0x02, 0x0C, 0x84, 0x8C, 0xFF,
-    0xC0, 0x80, 0x0A, 0x00, 0x84, 0x80, 0xC0, 0xFF, 0x8C, 0x02, 0x0C, 0x03, 0x00, 0x02, 0x01, 0x02,
-    0x00, 0x83, 0x19, 0x0F, 0x06, 0x02, 0x04, 0x02, 0x3C, 0x02, 0x04, 0x83, 0x06, 0x0F, 0x19, 0x02,
-    0x00, 0x02, 0x01, 0x03, 0x00,
-    // Character 1 (0x01)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##########--------
-    // -----############-------
-    // ----##############------
-    // ----##############------
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ---################-----
-    // ----##############------
-    // ----##############------
-    // -----############-------
-    // ------##########--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0xF0, 0x06, 0xF8, 0x02, 0xF0, 0x82, 0xE0, 0xC0, 0x09, 0x00,
-    0x81, 0x3F, 0x0E, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x81, 0x01, 0x02, 0x03, 0x06, 0x07, 0x02, 0x03,
-    0x81, 0x01, 0x07, 0x00,
-    // Character 2 (0x02)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##########--------
-    // -----############-------
-    // ----###########-##------
-    // ---############--#------
-    // ---############---#-----
-    // ---############---#-----
-    // --#############---#-----
-    // --#############---#-----
-    // ---############---#-----
-    // ---############---#-----
-    // ---############--#------
-    // ----###########-##------
-    // -----############-------
-    // ------##########--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x03, 0x00, 0x83, 0x80, 0xC0, 0xE0, 0x02, 0xF0, 0x06, 0xF8, 0x84, 0xF0, 0x30, 0x60, 0xC0, 0x08,
-    0x00, 0x82, 0x0C, 0x7F, 0x0B, 0xFF, 0x84, 0x00, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x81, 0x01, 0x02,
-    0x03, 0x06, 0x07, 0x02, 0x03, 0x81, 0x01, 0x07, 0x00,
-    // Character 3 (0x03)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------######--##--------
-    // -----#######---##-------
-    // ----########----##------
-    // ----########-----#------
-    // ---#########------#-----
-    // ---#########------#-----
-    // ---#########------#-----
-    // ---#########------#-----
-    // ---#########------#-----
-    // ---#########------#-----
-    // ----########-----#------
-    // ----########----##------
-    // -----#######---##-------
-    // ------######--##--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0xF0, 0x04, 0xF8, 0x02, 0x08, 0x84, 0x10, 0x30, 0x60, 0xC0,
-    0x09, 0x00, 0x81, 0x3F, 0x08, 0xFF, 0x04, 0x00, 0x83, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x81, 0x01,
-    0x02, 0x03, 0x04, 0x07, 0x02, 0x04, 0x83, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 4 (0x04)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------####----##--------
-    // -----#####-----##-------
-    // ----#####-------##------
-    // ----#####--------#------
-    // ---######---------#-----
-    // ---######---------#-----
-    // ---######---------#-----
-    // ---######---------#-----
-    // ---######---------#-----
-    // ---######---------#-----
-    // ----#####--------#------
-    // ----#####-------##------
-    // -----#####-----##-------
-    // ------####----##--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0xE0, 0x02, 0xF0, 0x82, 0xF8, 0x38, 0x04, 0x08, 0x84, 0x10, 0x30, 0x60,
-    0xC0, 0x09, 0x00, 0x81, 0x3F, 0x05, 0xFF, 0x07, 0x00, 0x83, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x81,
-    0x01, 0x02, 0x03, 0x02, 0x07, 0x04, 0x04, 0x83, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 5 (0x05)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##------##--------
-    // -----##--------##-------
-    // ----##----------##------
-    // ----#------------#------
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ---#--------------#-----
-    // ----#------------#------
-    // ----##----------##------
-    // -----##--------##-------
-    // ------##------##--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x84, 0xC0, 0x60, 0x30, 0x10, 0x06, 0x08, 0x84, 0x10, 0x30, 0x60, 0xC0, 0x09, 0x00,
-    0x83, 0x3F, 0xC0, 0x80, 0x0A, 0x00, 0x83, 0x80, 0xC0, 0x3F, 0x0A, 0x00, 0x83, 0x01, 0x03, 0x02,
-    0x06, 0x04, 0x83, 0x02, 0x03, 0x01, 0x07, 0x00,
-    // Character 6 (0x06)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##----####--------
-    // -----##-----#####-------
-    // ----##-------#####------
-    // ----#--------#####------
-    // ---#---------######-----
-    // ---#---------######-----
-    // ---#---------######-----
-    // ---#---------######-----
-    // ---#---------######-----
-    // ---#---------######-----
-    // ----#--------#####------
-    // ----##-------#####------
-    // -----##-----#####-------
-    // ------##----####--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x84, 0xC0, 0x60, 0x30, 0x10, 0x04, 0x08, 0x82, 0x38, 0xF8, 0x02, 0xF0, 0x82, 0xE0,
-    0xC0, 0x09, 0x00, 0x83, 0x3F, 0xC0, 0x80, 0x07, 0x00, 0x05, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x83,
-    0x01, 0x03, 0x02, 0x04, 0x04, 0x02, 0x07, 0x02, 0x03, 0x81, 0x01, 0x07, 0x00,
-    // Character 7 (0x07)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##--######--------
-    // -----##---#######-------
-    // ----##----########------
-    // ----#-----########------
-    // ---#------#########-----
-    // ---#------#########-----
-    // ---#------#########-----
-    // ---#------#########-----
-    // ---#------#########-----
-    // ---#------#########-----
-    // ----#-----########------
-    // ----##----########------
-    // -----##---#######-------
-    // ------##--######--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x84, 0xC0, 0x60, 0x30, 0x10, 0x02, 0x08, 0x04, 0xF8, 0x02, 0xF0, 0x82, 0xE0, 0xC0,
-    0x09, 0x00, 0x83, 0x3F, 0xC0, 0x80, 0x04, 0x00, 0x08, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x83, 0x01,
-    0x03, 0x02, 0x02, 0x04, 0x04, 0x07, 0x02, 0x03, 0x81, 0x01, 0x07, 0x00,
-    // Character 8 (0x08)
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // --------######----------
-    // ------##########--------
-    // -----############-------
-    // ----##############------
-    // ----#-############------
-    // ---#--#############-----
-    // ---#--#############-----
-    // ---#--#############-----
-    // ---#--#############-----
-    // ---#--#############-----
-    // ---#--#############-----
-    // ----#-############------
-    // ----##############------
-    // -----############-------
-    // ------##########--------
-    // --------######----------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    // ------------------------
-    0x04, 0x00, 0x82, 0xC0, 0x60, 0x02, 0xF0, 0x06, 0xF8, 0x02, 0xF0, 0x82, 0xE0, 0xC0, 0x09, 0x00,
-    0x83, 0x3F, 0xC0, 0x80, 0x0C, 0xFF, 0x81, 0x3F, 0x0A, 0x00, 0x81, 0x01, 0x02, 0x03, 0x06, 0x07,
-    0x02, 0x03, 0x81, 0x01, 0x07, 0x00,
-};
@@ -1,10 +0,0 @@
-#ifndef SUN_MOON_ICONS_LIGHT_H
-#define SUN_MOON_ICONS_LIGHT_H
-// Generated font data for sun_moon_icons_light.yaml
-
-#include <inttypes.h>
-#include <avr/pgmspace.h>
-
-extern const uint8_t sun_moon_icons_light[] PROGMEM;
-
-#endif  // SUN_MOON_ICONS_LIGHT_H
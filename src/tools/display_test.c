@@ -0,0 +1,357 @@
+// Host test of display.c and menu.c on top of the SSD1680 emulator
+// (lib/oledm/ssd1680_emulator.c).  Build and run with "make test" in this
+// directory.
+//
+// A few hours of the clock are replayed a minute at a time, the same way
+// that main.c prepares a frame ahead and shows it on the minute.  Then the
+// GPS stats are shown and the menu is used to change every option.
+//
+// Every frame has an SPI byte budget for its kind (see the *_BUDGET
+// defines).  Going over fails the test.  Lower them when a change makes
+// things cheaper.
+//
+// At a few points, what the panel shows is compared against golden/*.pbm.
+// On a mismatch, the panel is written to <name>.actual.pbm in this
+// directory.  After a change that is supposed to change the display, run
+// "make goldens" to rewrite them and look at the result before checking
+// them in.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../display.h"
+#include "../buttons.h"
+#include "../gps.h"
+#include "../menu.h"
+#include <oledm/ssd1680_emulator.h>
+
+// SPI bytes per frame
+#define FULL_FRAME_BUDGET 9444
+#define MINUTE_FRAME_BUDGET 5326
+#define GRAPH_FRAME_BUDGET 5315
+#define GPS_STATS_FRAME_BUDGET 6056
+#define MENU_FRAME_BUDGET 1605
+
+// 2024-06-15 08:55 UTC
+#define START_TIME_Y2K 771756900UL
+#define REPLAY_MINUTES 180
+// 10:10, when a graph point is added
+#define DROPPED_FRAME_MINUTE 75
+
+// Registers declared by host/avr/io.h
+volatile uint8_t DDRB;
+volatile uint8_t PORTB;
+volatile uint8_t DDRD;
+volatile uint8_t PORTD;
+volatile uint8_t PIND;
+volatile uint8_t PCICR;
+volatile uint8_t PCMSK2;
+
+// From oledm_spi.c, which the emulator stands in for
+void oledm_ifaceInit(void);
+
+static uint16_t failures;
+
+//
+// Stand-ins for the rest of the firmware
+//
+
+static struct GPSStats gps_stats;
+
+const struct GPSStats* gps_get_stats(void) {
+  return &gps_stats;
+}
+
+void gps_stat_show_policy(GPSStatShowPolicy show_policy) {
+  gps_stats.show_policy = show_policy;
+}
+
+void save_eeprom(struct EEPromVars* eeprom) {
+}
+
+void spi_initMasterFreq(uint8_t flags, uint32_t freq) {
+}
+
+// The emulator never sets BUSY, so this is never called
+static void busy_sleep(void) {
+}
+
+static uint8_t busy_seconds(void) {
+  return 0;
+}
+
+//
+// Test helpers
+//
+
+static struct EEPromVars eeprom;
+
+// A slow fall and recovery of about 20 hPa with some noise on top, like a
+// front passing through.
+static void collect_data(struct DisplayInfo* dinfo, time_t time_y2k) {
+  const uint16_t minute = (time_y2k - START_TIME_Y2K) / 60;
+  const uint16_t phase = minute % 180;
+  const uint16_t dip = phase < 90 ? phase : 180 - phase;
+  dinfo->time_y2k = time_y2k;
+  dinfo->position_was_set = 1;
+  dinfo->pressure_pa = 101500 - dip * 22 + (minute * 37) % 50;
+  dinfo->temp_cc = 2150 + minute * 3;
+  dinfo->humidity_cpct = 4500 - minute * 5;
+}
+
+// Fails if the last frame went over budget
+static void check_budget(const char* kind, time_t time_y2k, uint32_t budget) {
+  const uint32_t bytes = ssd1680_emulator_spi_bytes();
+  if (bytes > budget) {
+    struct tm t;
+    localtime_r(&time_y2k, &t);
+    printf("%s frame at %02d:%02d sent %u SPI bytes, the budget is %u\n",
+           kind, t.tm_hour, t.tm_min, bytes, budget);
+    ++failures;
+  }
+}
+
+static uint8_t read_file(const char* path, char* buf, size_t size, size_t* len) {
+  FILE* fp = fopen(path, "r");
+  if (!fp) {
+    return 0;
+  }
+  *len = fread(buf, 1, size, fp);
+  fclose(fp);
+  return 1;
+}
+
+// Compares the panel against golden/<name>.pbm, or rewrites it when
+// DISPLAY_TEST_UPDATE_GOLDENS is set.
+static void check_golden(const char* name) {
+  char golden_path[64];
+  snprintf(golden_path, sizeof(golden_path), "golden/%s.pbm", name);
+  if (getenv("DISPLAY_TEST_UPDATE_GOLDENS")) {
+    ssd1680_emulator_write_pbm(golden_path);
+    return;
+  }
+
+  char actual_path[64];
+  snprintf(actual_path, sizeof(actual_path), "%s.actual.pbm", name);
+  ssd1680_emulator_write_pbm(actual_path);
+
+  static char golden[65536];
+  static char actual[65536];
+  size_t golden_len;
+  size_t actual_len;
+  if (!read_file(golden_path, golden, sizeof(golden), &golden_len)) {
+    printf("%s is missing, see %s\n", golden_path, actual_path);
+    ++failures;
+    return;
+  }
+  read_file(actual_path, actual, sizeof(actual), &actual_len);
+  if ((golden_len != actual_len) || memcmp(golden, actual, golden_len)) {
+    printf("The panel does not match %s, see %s\n", golden_path, actual_path);
+    ++failures;
+    return;
+  }
+  remove(actual_path);
+}
+
+static void check_error(const char* where) {
+  if (display_device()->error) {
+    printf("%s: display error %d\n", where, display_device()->error);
+    ++failures;
+    display_device()->error = 0;
+  }
+}
+
+static uint8_t panel[SSD1680_EMULATOR_COLUMNS][128];
+
+static void save_panel(void) {
+  for (uint16_t column = 0; column < SSD1680_EMULATOR_COLUMNS; ++column) {
+    for (uint8_t y = 0; y < 128; ++y) {
+      panel[column][y] = ssd1680_emulator_panel_pixel(column, y);
+    }
+  }
+}
+
+// Returns the number of pixels that differ from save_panel()
+static uint16_t panel_changes(void) {
+  uint16_t changes = 0;
+  for (uint16_t column = 0; column < SSD1680_EMULATOR_COLUMNS; ++column) {
+    for (uint8_t y = 0; y < 128; ++y) {
+      changes += panel[column][y] != ssd1680_emulator_panel_pixel(column, y);
+    }
+  }
+  return changes;
+}
+
+// What main.c does for a minute: the frame is prepared a few seconds ahead
+// and shown on the minute.  Both count towards the cost of the frame.
+static void show_minute(time_t time_y2k) {
+  struct DisplayInfo dinfo;
+  collect_data(&dinfo, time_y2k);
+  ssd1680_emulator_reset_stats();
+  display_prepare(&dinfo, &eeprom);
+  display_show();
+}
+
+//
+// Tests
+//
+
+static void test_clock(void) {
+  time_t time_y2k = START_TIME_Y2K;
+  struct DisplayInfo dinfo;
+
+  // Power up
+  collect_data(&dinfo, time_y2k);
+  ssd1680_emulator_reset_stats();
+  update_display(&dinfo, &eeprom);
+  check_error("power up");
+  check_budget("Full", time_y2k, FULL_FRAME_BUDGET);
+
+  for (uint16_t i = 1; i <= REPLAY_MINUTES; ++i) {
+    time_y2k += 60;
+    if (i == DROPPED_FRAME_MINUTE) {
+      // A button press a few seconds before the minute drops the frame that
+      // was prepared for it.  main.c then draws the current time and
+      // prepares the minute again, which must not add a second graph point.
+      collect_data(&dinfo, time_y2k);
+      display_prepare(&dinfo, &eeprom);
+      collect_data(&dinfo, time_y2k - 3);
+      update_display(&dinfo, &eeprom);
+      check_error("dropped frame");
+    }
+    show_minute(time_y2k);
+    check_error("replay");
+
+    const struct SSD1680EmulatorStats* s = &ssd1680_emulator_stats;
+    if (s->last_refresh == SSD1680_EMULATOR_FULL_REFRESH) {
+      check_budget("Full", time_y2k, FULL_FRAME_BUDGET);
+    } else if (((time_y2k / 60) % 10) == 0) {
+      check_budget("Graph", time_y2k, GRAPH_FRAME_BUDGET);
+    } else {
+      check_budget("Minute", time_y2k, MINUTE_FRAME_BUDGET);
+    }
+  }
+  check_golden("clock");
+
+  // The partial refreshes should have left the panel the same as a full
+  // refresh would.
+  save_panel();
+  display_force_full_refresh();
+  collect_data(&dinfo, time_y2k);
+  update_display(&dinfo, &eeprom);
+  if (ssd1680_emulator_stats.last_refresh != SSD1680_EMULATOR_FULL_REFRESH) {
+    printf("display_force_full_refresh() did not lead to a full refresh\n");
+    ++failures;
+  }
+  const uint16_t changes = panel_changes();
+  if (changes) {
+    printf("A full refresh changed %u pixels left by partial refreshes\n", changes);
+    ++failures;
+  }
+}
+
+static void test_gps_stats(void) {
+  time_t time_y2k = START_TIME_Y2K + (REPLAY_MINUTES + 1) * 60;
+  gps_stats.enable_time_y2k = time_y2k - 45;
+  gps_stats.last_enable = time_y2k - 45;
+  gps_stats.last_lock = time_y2k - 3600;
+  gps_stats.total_enable_seconds = 1234;
+  gps_stats.received_messages = 5678;
+  gps_stats.uart_bytes_received = 98765;
+  gps_stats.last_enable_seconds = 38;
+  gps_stats.enable_count = 12;
+  gps_stats.timeouts = 1;
+  gps_stat_show_policy(GPS_STATS_SHOW);
+
+  // The space after "GPS:" lands on the top line of the graph, which is
+  // drawn first.  Skipping the space would leave the line showing through.
+  const uint16_t space_column = 22;
+  const uint8_t graph_top_y = 80;
+  if (!ssd1680_emulator_panel_pixel(space_column, graph_top_y)) {
+    printf("The graph is not where test_gps_stats() expects it\n");
+    ++failures;
+  }
+
+  show_minute(time_y2k);
+  check_error("gps stats");
+  check_budget("GPS stats", time_y2k, GPS_STATS_FRAME_BUDGET);
+  check_golden("gps_stats");
+  if (ssd1680_emulator_panel_pixel(space_column, graph_top_y)) {
+    printf("The graph shows through a space in the GPS stats\n");
+    ++failures;
+  }
+
+  gps_stat_show_policy(GPS_STATS_HIDE);
+  show_minute(time_y2k + 60);
+  check_error("gps stats hidden");
+}
+
+// Presses the button and checks the cost of the menu frame
+static uint8_t press(uint8_t button, time_t time_y2k) {
+  ssd1680_emulator_reset_stats();
+  const uint8_t menu_mode = update_menu(button, time_y2k, &eeprom);
+  check_error("menu");
+  if (ssd1680_emulator_stats.last_refresh == SSD1680_EMULATOR_PARTIAL_REFRESH) {
+    check_budget("Menu", time_y2k, MENU_FRAME_BUDGET);
+  }
+  return menu_mode;
+}
+
+static void test_menu(void) {
+  time_t time_y2k = START_TIME_Y2K + (REPLAY_MINUTES + 3) * 60;
+  menu_init(time_y2k, &eeprom);
+  check_error("menu_init");
+
+  press(OPTION_WAS_PRESSED, time_y2k);
+  press(OPTION_WAS_PRESSED, time_y2k);
+  check_golden("menu");
+
+  // dark mode, 24h time, metric, finished
+  press(OPTION_WAS_PRESSED, time_y2k);
+  press(SELECT_WAS_PRESSED, time_y2k);
+  press(OPTION_WAS_PRESSED, time_y2k);
+  press(SELECT_WAS_PRESSED, time_y2k);
+  press(OPTION_WAS_PRESSED, time_y2k);
+  press(SELECT_WAS_PRESSED, time_y2k);
+  press(OPTION_WAS_PRESSED, time_y2k);
+  if (press(SELECT_WAS_PRESSED, time_y2k)) {
+    printf("The menu did not finish\n");
+    ++failures;
+  }
+  if (eeprom.option_bits !=
+      (OPTION_DARK_MODE | OPTION_USE_24H_TIME | OPTION_USE_METRIC)) {
+    printf("The menu set option_bits to 0x%02X\n", eeprom.option_bits);
+    ++failures;
+  }
+
+  time_y2k += 60;
+  struct DisplayInfo dinfo;
+  collect_data(&dinfo, time_y2k);
+  ssd1680_emulator_reset_stats();
+  update_display(&dinfo, &eeprom);
+  check_error("after menu");
+  check_budget("Full", time_y2k, FULL_FRAME_BUDGET);
+  check_golden("clock_dark");
+}
+
+int main(void) {
+  ssd1680_emulator_reset();
+  // What main.c does on power up
+  oledm_ifaceInit();
+  display_enable_spi();
+  display_init(busy_sleep, busy_seconds);
+  // A GPS lock hides the stats (GPS_STATS_AUTO) so the graph shows
+  gps_stats.last_lock = START_TIME_Y2K - 600;
+
+  test_clock();
+  test_gps_stats();
+  test_menu();
+
+  if (failures) {
+    printf("%u failures\n", failures);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,10 @@
+// Host stand-in for avr/interrupt.h, used by display_test.c
+#ifndef TOOLS_HOST_AVR_INTERRUPT_H
+#define TOOLS_HOST_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,18 @@
+// Host stand-in for avr/io.h, used by display_test.c.  Only the registers
+// that display.c and ssd1680.c touch.  They are defined in display_test.c
+#ifndef TOOLS_HOST_AVR_IO_H
+#define TOOLS_HOST_AVR_IO_H
+
+#include <inttypes.h>
+
+extern volatile uint8_t DDRB;
+extern volatile uint8_t PORTB;
+extern volatile uint8_t DDRD;
+extern volatile uint8_t PORTD;
+extern volatile uint8_t PIND;
+extern volatile uint8_t PCICR;
+extern volatile uint8_t PCMSK2;
+
+#define PCIE2 2
+
+#endif
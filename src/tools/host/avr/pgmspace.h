@@ -0,0 +1,14 @@
+// Host stand-in for avr/pgmspace.h, used by display_test.c.  Flash is
+// plain memory.
+#ifndef TOOLS_HOST_AVR_PGMSPACE_H
+#define TOOLS_HOST_AVR_PGMSPACE_H
+
+#include <inttypes.h>
+#include <string.h>
+
+#define PROGMEM
+#define pgm_read_byte_near(p) (*(const uint8_t*)(p))
+#define pgm_read_byte(p) pgm_read_byte_near(p)
+#define memcpy_P memcpy
+
+#endif
@@ -0,0 +1,73 @@
+// Host stand-in for the avr-libc time functions.  See time.h
+#include <time.h>
+
+static int32_t utc_offset;
+
+void set_zone(int32_t zone) {
+  utc_offset = zone;
+}
+
+static uint8_t is_leap_year(uint16_t year) {
+  return (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+}
+
+static const uint8_t days_in_month[12] = {
+  31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+void gmtime_r(const time_t* timer, struct tm* timeptr) {
+  time_t t = *timer;
+  timeptr->tm_sec = t % 60;
+  t /= 60;
+  timeptr->tm_min = t % 60;
+  t /= 60;
+  timeptr->tm_hour = t % 24;
+  uint32_t days = t / 24;
+  // 2000-01-01 was a Saturday
+  timeptr->tm_wday = (days + 6) % 7;
+
+  uint16_t year = 2000;
+  while (days >= (is_leap_year(year) ? 366 : 365)) {
+    days -= is_leap_year(year) ? 366 : 365;
+    ++year;
+  }
+  timeptr->tm_year = year - 1900;
+  timeptr->tm_yday = days;
+
+  uint8_t month = 0;
+  for (;; ++month) {
+    const uint8_t mdays =
+        days_in_month[month] + ((month == 1) && is_leap_year(year));
+    if (days < mdays) {
+      break;
+    }
+    days -= mdays;
+  }
+  timeptr->tm_mon = month;
+  timeptr->tm_mday = days + 1;
+  timeptr->tm_isdst = 0;
+}
+
+void localtime_r(const time_t* timer, struct tm* timeptr) {
+  const time_t t = *timer + utc_offset;
+  gmtime_r(&t, timeptr);
+}
+
+// The real ones depend on the position from the GPS.  A fixed 6:12 AM and
+// 7:47 PM (UTC) keeps the goldens the same no matter where they are made.
+time_t sun_rise(const time_t* timer) {
+  return *timer - (*timer % ONE_DAY) + 6 * ONE_HOUR + 12 * 60;
+}
+
+time_t sun_set(const time_t* timer) {
+  return *timer - (*timer % ONE_DAY) + 19 * ONE_HOUR + 47 * 60;
+}
+
+// -100 (waning) to 100 (waxing), with 0 being a new moon.  A plain
+// 29.53 day cycle from the new moon on 2000-01-06.
+#define SYNODIC_MONTH 2551443UL
+int8_t moon_phase(const time_t* timer) {
+  const uint32_t age = (*timer - 5 * ONE_DAY) % SYNODIC_MONTH;
+  const int16_t phase = (int16_t)((age * 200) / SYNODIC_MONTH);
+  return phase <= 100 ? phase : phase - 200;
+}
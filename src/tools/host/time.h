@@ -0,0 +1,35 @@
+// Host stand-in for the avr-libc time.h, used by display_test.c.  time_t
+// counts seconds from 2000-01-01 00:00 UTC, the same as on the AVR.  Only
+// what the clock uses is here.  See time.c
+#ifndef TOOLS_HOST_TIME_H
+#define TOOLS_HOST_TIME_H
+
+#include <inttypes.h>
+
+typedef uint32_t time_t;
+
+struct tm {
+  int8_t tm_sec;
+  int8_t tm_min;
+  int8_t tm_hour;
+  int8_t tm_mday;
+  int8_t tm_wday;
+  int8_t tm_mon;
+  int16_t tm_year;
+  int16_t tm_yday;
+  int16_t tm_isdst;
+};
+
+#define ONE_HOUR 3600
+#define ONE_DAY 86400
+
+void set_zone(int32_t zone);
+void gmtime_r(const time_t* timer, struct tm* timeptr);
+void localtime_r(const time_t* timer, struct tm* timeptr);
+
+// These return fixed, made up values.  See time.c
+time_t sun_rise(const time_t* timer);
+time_t sun_set(const time_t* timer);
+int8_t moon_phase(const time_t* timer);
+
+#endif
@@ -0,0 +1,16 @@
+// Host stand-in for util/crc16.h, used by display_test.c.  Same polynomial
+// (0xA001) as the avr-libc version.
+#ifndef TOOLS_HOST_UTIL_CRC16_H
+#define TOOLS_HOST_UTIL_CRC16_H
+
+#include <inttypes.h>
+
+static inline uint16_t _crc16_update(uint16_t crc, uint8_t a) {
+  crc ^= a;
+  for (uint8_t i = 0; i < 8; ++i) {
+    crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : (crc >> 1);
+  }
+  return crc;
+}
+
+#endif
@@ -0,0 +1,9 @@
+// Host stand-in for util/delay.h, used by display_test.c.  The emulated
+// display never needs time to catch up.
+#ifndef TOOLS_HOST_UTIL_DELAY_H
+#define TOOLS_HOST_UTIL_DELAY_H
+
+#define _delay_ms(ms)
+#define _delay_us(us)
+
+#endif